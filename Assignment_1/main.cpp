@@ -1,340 +1,23 @@
 #include <iostream>
-#include <fstream>
 #include <string>
 #include <vector>
-#include <sstream>
-#include <cmath>
-#include <algorithm>
-#include <cstdlib>
-#include <ctime>
-#include <random>
-#include <climits>
-#include <limits>
-#include <cstdint>
-#include <chrono>
 
-bool getDataFromFile(const std::string &filename, std::vector<std::vector<int>> &data)
-{
-    std::ifstream file("../TSPA.csv");
-    if (!file.is_open())
-    {
-        std::cerr << "Error: Could not open the file!" << std::endl;
-        return false;
-    }
-
-    std::string line;
-    while (std::getline(file, line))
-    {
-        std::stringstream ss(line);
-        std::string value;
-        std::vector<int> row;
-
-        while (std::getline(ss, value, ';'))
-        {
-            try
-            {
-                row.push_back(std::stoi(value));
-            }
-            catch (const std::invalid_argument &e)
-            {
-                std::cerr << "Invalid data: " << value << std::endl;
-                return false;
-            }
-        }
-
-        data.push_back(row);
-    }
-
-    file.close();
-    return true;
-}
-
-int getEuclidanDistance(int x1, int y1, int x2, int y2)
-{
-    return static_cast<int>(std::sqrt(std::pow(x2 - x1, 2) + std::pow(y2 - y1, 2)));
-}
-
-int **getDistanceMatrix(std::vector<std::vector<int>> &data, int &size)
-{
-    int **distanceMatrix = new int *[size];
-    for (int16_t i = 0; i < size; i++)
-    {
-        distanceMatrix[i] = new int[size];
-        for (int16_t j = 0; j < size; j++)
-        {
-            if (i == j)
-                distanceMatrix[i][j] = 0;
-            else
-                distanceMatrix[i][j] = getEuclidanDistance(data[i][0], data[i][1], data[j][0], data[j][1]);
-        }
-    }
-
-    return distanceMatrix;
-}
-
-std::vector<int> getCostVector(std::vector<std::vector<int>> &data)
-{
-    std::vector<int> nodeCosts;
-    for (const auto &row : data)
-    {
-        nodeCosts.push_back(row[2]);
-    }
-
-    data.clear();
-    return nodeCosts;
-}
-
-int evaluateSolution(std::vector<int> &solution, int **distanceMatrix, std::vector<int> &costVector)
-{
-    int totalCost = 0;
-    for (size_t i = 0; i < solution.size(); ++i)
-    {
-        totalCost += costVector[solution[i]];
-        if (i > 0)
-        {
-            totalCost += distanceMatrix[solution[i - 1]][solution[i]];
-        }
-    }
-    return totalCost;
-}
-
-// Random solution algorithm
-void randomSolution(int **distanceMatrix, std::vector<int> &costVector, int &dataSize)
-{
-    srand(time(NULL));
-    if (dataSize % 2 != 0)
-    {
-        dataSize++;
-    }
-    int numberOfNodesToVisit = dataSize / 2;
-    std::vector<int> bestSolution;
-    int bestSolutionScore = INT_MAX;
-    int worstSolutionScore = INT_MIN;
-    float avgScore = 0.0f;
-    for (int i = 0; i < 200; i++)
-    {
-        std::vector<int> currentSolution;
-        while (currentSolution.size() < numberOfNodesToVisit)
-        {
-            int randomNode = rand() % dataSize;
-            if (std::find(currentSolution.begin(), currentSolution.end(), randomNode) == currentSolution.end())
-            {
-                currentSolution.push_back(randomNode);
-            }
-        }
-        int currentScore = evaluateSolution(currentSolution, distanceMatrix, costVector);
-        if (currentScore < bestSolutionScore)
-        {
-            bestSolution = currentSolution;
-            bestSolutionScore = evaluateSolution(currentSolution, distanceMatrix, costVector);
-        }
-
-        if (currentScore > worstSolutionScore)
-        {
-            worstSolutionScore = currentScore;
-        }
-
-        avgScore += currentScore;
-    }
-
-    avgScore /= 200;
-
-    std::cout << "====== Random solution ======" << std::endl;
-    std::cout << "Best solution score: " << bestSolutionScore << " | Worst solution score: " << worstSolutionScore << " | Average score: " << avgScore << std::endl;
-    std::cout << "Best solution: ";
-    for (const auto &node : bestSolution)
-    {
-        std::cout << node << " ";
-    }
-    std::cout << std::endl;
-}
+#include "../methodRegistry.h"
 
-// Nearest Neighbour algorithm (only adding at the end)
-int getBestNearestNeighbour(int currentNode, std::vector<int> &unvisitedNodes, int **distanceMatrix, std::vector<int> &costVector)
+// Random and nearest-neighbour constructions; the implementations live in constructors.cpp
+int main()
 {
-    int bestNode = -1;
-    int bestScore = INT_MAX;
-    for (const auto &node : unvisitedNodes)
-    {
-        if (distanceMatrix[currentNode][node] + costVector[node] < bestScore)
-        {
-            bestScore = distanceMatrix[currentNode][node] + costVector[node];
-            bestNode = node;
-        }
-    }
-
-    return bestNode;
-}
-
-void nearestNeighbourSolutionOnlyAtEnd(int **distanceMatrix, std::vector<int> &costVector, int &dataSize)
-{
-    srand(time(NULL));
-    if (dataSize % 2 != 0)
-    {
-        dataSize++;
-    }
-    int numberOfNodesToVisit = dataSize / 2;
-    std::vector<int> bestSolution;
-    int bestSolutionScore = INT_MAX;
-    int worstSolutionScore = INT_MIN;
-    float avgScore = 0.0f;
-    for (int i = 0; i < 200; i++)
-    {
-        std::vector<int> currentSolution;
-        int startingNode = rand() % dataSize;
-        currentSolution.push_back(startingNode);
-
-        std::vector<int> unvisitedNodes;
-        for (int j = 0; j < dataSize; j++)
-        {
-            if (j != startingNode)
-            {
-                unvisitedNodes.push_back(j);
-            }
-        }
-
-        while (currentSolution.size() < numberOfNodesToVisit)
-        {
-            int nextNode = getBestNearestNeighbour(currentSolution.back(), unvisitedNodes, distanceMatrix, costVector);
-            if (nextNode != -1)
-            {
-                currentSolution.push_back(nextNode);
-                unvisitedNodes.erase(std::remove(unvisitedNodes.begin(), unvisitedNodes.end(), nextNode), unvisitedNodes.end());
-            }
-            else
-            {
-                break;
-            }
-        }
+    ExperimentSpec spec;
+    spec.instances = {"../TSPA.csv", "../TSPB.csv"};
+    spec.methods = {"random", "nearestNeighbourEnd", "nearestNeighbourInsertion"};
+    spec.runs = 200;
 
-        int currentScore = evaluateSolution(currentSolution, distanceMatrix, costVector);
-        if (currentScore < bestSolutionScore)
-        {
-            bestSolution = currentSolution;
-            bestSolutionScore = currentScore;
-        }
-
-        if (currentScore > worstSolutionScore)
-        {
-            worstSolutionScore = currentScore;
-        }
-
-        avgScore += currentScore;
-    }
-
-    avgScore /= 200;
-
-    std::cout << "====== Nearest Neighbour solution only adding at the end ======" << std::endl;
-    std::cout << "Best solution score: " << bestSolutionScore << " | Worst solution score: " << worstSolutionScore << " | Average score: " << avgScore << std::endl;
-    std::cout << "Best solution: ";
-    for (const auto &node : bestSolution)
+    const auto &registry = getMethodRegistry();
+    runExperiment(spec, getSchedulableMethods(), [&](const ExperimentOutcome &outcome)
     {
-        std::cout << node << " ";
-    }
-    std::cout << std::endl;
-}
-
-void nearestNeighbourSolution(int **distanceMatrix, std::vector<int> &nodeCostVector, int numberOfNodes, int numberOfSolutionsPerStart = 200)
-{
-    if (numberOfNodes <= 0)
-        return;
-
-    int nodesToVisit = (numberOfNodes % 2 == 0) ? (numberOfNodes / 2) : ((numberOfNodes + 1) / 2);
-
-    std::mt19937 rng(std::random_device{}());
-    std::uniform_int_distribution<int> startDist(0, numberOfNodes - 1);
-
-    long long totalSum = 0;
-    int bestObjective = std::numeric_limits<int>::max();
-    int worstObjective = std::numeric_limits<int>::min();
-    std::vector<int> bestSolution;
-
-    // Run a fixed number of constructions (avoid multiplying by numberOfNodes)
-    int totalRuns = numberOfSolutionsPerStart; // <<< use same scale as M6
-    for (int run = 0; run < totalRuns; ++run)
-    {
-        int startNode = startDist(rng);
-
-        std::vector<int> routeNodes;
-        routeNodes.reserve(nodesToVisit);
-        std::vector<char> isNodeUsed(numberOfNodes, 0);
-
-        routeNodes.push_back(startNode);
-        isNodeUsed[startNode] = 1;
-
-        while ((int)routeNodes.size() < nodesToVisit)
-        {
-            int bestObjectiveDelta = std::numeric_limits<int>::max();
-            std::vector<int> candidates;
-
-            for (int candidateNode = 0; candidateNode < numberOfNodes; ++candidateNode)
-            {
-                if (isNodeUsed[candidateNode])
-                    continue;
-
-                for (size_t insertionPosition = 0; insertionPosition <= routeNodes.size(); ++insertionPosition)
-                {
-                    int predecessorNode = (insertionPosition == 0) ? -1 : routeNodes[insertionPosition - 1];
-                    int successorNode = (insertionPosition == routeNodes.size()) ? -1 : routeNodes[insertionPosition];
-
-                    int addedDistance = 0;
-                    if (predecessorNode != -1)
-                        addedDistance += distanceMatrix[predecessorNode][candidateNode];
-                    if (successorNode != -1)
-                        addedDistance += distanceMatrix[candidateNode][successorNode];
-
-                    int removedDistance = 0;
-                    if (predecessorNode != -1 && successorNode != -1)
-                        removedDistance = distanceMatrix[predecessorNode][successorNode];
-
-                    int objectiveDelta = nodeCostVector[candidateNode] + (addedDistance - removedDistance);
-
-                    if (objectiveDelta < bestObjectiveDelta)
-                    {
-                        bestObjectiveDelta = objectiveDelta;
-                        candidates.clear();
-                        candidates.push_back(static_cast<int>(insertionPosition) << 24 | candidateNode);
-                    }
-                    else if (objectiveDelta == bestObjectiveDelta)
-                    {
-                        candidates.push_back(static_cast<int>(insertionPosition) << 24 | candidateNode);
-                    }
-                }
-            }
-
-            if (candidates.empty())
-                break;
-
-            std::uniform_int_distribution<int> pick(0, (int)candidates.size() - 1);
-            int chosen = candidates[pick(rng)];
-            int chosenInsertion = (chosen >> 24) & 0xFF;
-            int chosenCandidate = chosen & 0xFFFFFF;
-
-            routeNodes.insert(routeNodes.begin() + chosenInsertion, chosenCandidate);
-            isNodeUsed[chosenCandidate] = 1;
-        }
-
-        int objectiveValue = evaluateSolution(routeNodes, distanceMatrix, nodeCostVector);
-        totalSum += objectiveValue;
-        if (objectiveValue < bestObjective)
-        {
-            bestObjective = objectiveValue;
-            bestSolution = routeNodes;
-        }
-        if (objectiveValue > worstObjective)
-            worstObjective = objectiveValue;
-    }
-
-    double averageObjective = static_cast<double>(totalSum) / totalRuns;
-    std::cout << "====== Nearest neighbor (insertion) ======\n";
-    std::cout << "  runs = " << totalRuns << "\n";
-    std::cout << "  min = " << bestObjective << "\n";
-    std::cout << "  max = " << worstObjective << "\n";
-    std::cout << "  avg = " << averageObjective << "\n";
+        std::cout << "\nRunning " << outcome.method << " on file: " << outcome.instance << std::endl;
+        printMultiStartResult(registry.at(outcome.method).title, outcome.result);
+    });
 
-    std::cout << "Best solution score: " << bestObjective << std::endl;
-    std::cout << "Best solution: ";
-    for (const auto &n : bestSolution)
-        std::cout << n << " ";
-    std::cout << std::endl;
+    return 0;
 }
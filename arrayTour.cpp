@@ -0,0 +1,52 @@
+#include <algorithm>
+
+#include "arrayTour.h"
+
+void ArrayTour::assign(const std::vector<int> &solution) {
+    for (int v : order) pos[v] = -1;
+    order = solution;
+    for (int i = 0; i < length(); ++i) pos[order[i]] = i;
+    reversed = false;
+}
+
+std::vector<int> ArrayTour::toSolution() const {
+    std::vector<int> solution = order;
+    if (reversed && !solution.empty()) std::reverse(solution.begin() + 1, solution.end());
+    return solution;
+}
+
+bool ArrayTour::between(int a, int b, int c) const {
+    if (reversed) std::swap(a, c);
+    int n = length();
+    int pa = pos[a];
+    return (pos[b] - pa + n) % n <= (pos[c] - pa + n) % n;
+}
+
+void ArrayTour::reverse(int a, int b) {
+    int n = length();
+    int i = pos[reversed ? b : a], j = pos[reversed ? a : b];
+    int len = (j - i + n) % n + 1;
+
+    // Reversing the rest of the cycle gives the same cycle walked the other way
+    if (2 * len > n) {
+        int k = after(j);
+        j = before(i);
+        i = k;
+        len = n - len;
+        reversed = !reversed;
+    }
+
+    for (int s = 0; s < len / 2; ++s) {
+        std::swap(order[i], order[j]);
+        pos[order[i]] = i;
+        pos[order[j]] = j;
+        i = after(i);
+        j = before(j);
+    }
+}
+
+void ArrayTour::replace(int u, int w) {
+    order[pos[u]] = w;
+    pos[w] = pos[u];
+    pos[u] = -1;
+}
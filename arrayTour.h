@@ -0,0 +1,44 @@
+#ifndef ARRAY_TOUR_H
+#define ARRAY_TOUR_H
+
+#include <vector>
+
+/**
+ * @brief Tour as an array with a position index and an orientation bit.
+ * next/prev/between are O(1). reverse() reverses the shorter of the path and
+ * the rest of the cycle and flips the orientation in the second case, so a
+ * 2-opt move costs at most n/2 swaps. Nodes outside the tour have position -1
+ * and can take the place of a tour node in O(1).
+ */
+class ArrayTour {
+public:
+    explicit ArrayTour(int size = 0) : pos(size, -1) {}
+
+    void assign(const std::vector<int> &solution);
+    // The tour in its current orientation, starting at the first array slot
+    std::vector<int> toSolution() const;
+
+    int length() const { return static_cast<int>(order.size()); }
+    bool contains(int v) const { return pos[v] != -1; }
+    int next(int v) const { return order[reversed ? before(pos[v]) : after(pos[v])]; }
+    int prev(int v) const { return order[reversed ? after(pos[v]) : before(pos[v])]; }
+
+    // True if b lies on the path a -> ... -> c that follows next (a and c included)
+    bool between(int a, int b, int c) const;
+    // Reverses the path a -> ... -> b that follows next; afterwards it reads b -> ... -> a
+    void reverse(int a, int b);
+    // The unselected node w takes the place of the tour node u
+    void replace(int u, int w);
+    // Walks the same cycle the other way round
+    void flipOrientation() { reversed = !reversed; }
+
+private:
+    int after(int i) const { return i + 1 == length() ? 0 : i + 1; }
+    int before(int i) const { return i == 0 ? length() - 1 : i - 1; }
+
+    std::vector<int> order;
+    std::vector<int> pos;
+    bool reversed = false;
+};
+
+#endif
@@ -0,0 +1,271 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <memory>
+
+#include "benchmarkHarness.h"
+#include "dataManager.h"
+#include "methodRegistry.h"
+#include "localSearch.h"
+#include "tourUtils.h"
+#include "constructionCache.h"
+#include "instanceCache.h"
+#include "solutionPool.h"
+#include "perfCounters.h"
+
+/**
+ * @brief Micro- and macro-benchmarks of the library.
+ *
+ *   benchmark [--sizes 50,100,200] [--methods M1,M3,...] [--reps 7] [--warmup 1] [--runs 5]
+ *             [--seed 1] [--param name=value] [--micro] [--macro] [--perf] [--output FILE]
+ *
+ * Micro-benchmarks time the kernels (objective, distances, segment reversal,
+ * edge lookup, candidate lists, move generation) per call; macro-benchmarks
+ * time every registered method per run on synthetic instances of each size.
+ * All results are written as one JSON document for comparison across versions.
+ * --perf adds hardware events (cycles, IPC, L1d/LLC and branch misses) per run
+ * and per scored move to the macro-benchmarks where perf_event_open is permitted.
+ * The group counts the calling thread, so the scans then run single-threaded and
+ * methods that start threads of their own (methodThreads) are timed without it.
+ * --param overrides a default of every method that has the parameter, e.g.
+ * or3opt=1 for candidateListSteepest; the benchmark name then lists it.
+ */
+
+namespace {
+    struct BenchmarkConfig {
+        std::vector<int> sizes = {50, 100, 200};
+        std::vector<std::string> methods; // empty = every registered method
+        int repetitions = 7;
+        int warmup = 1;
+        int runs = 5;
+        uint64_t seed = 1;
+        bool micro = true;
+        bool macro = true;
+        bool perf = false; // hardware counters around the macro-benchmark repetitions
+        ExperimentParams params; // overrides of method defaults
+        std::string output;
+    };
+
+    std::vector<std::string> splitList(const std::string &text) {
+        std::vector<std::string> items;
+        std::stringstream ss(text);
+        std::string item;
+        while (std::getline(ss, item, ','))
+            if (!item.empty()) items.push_back(item);
+        return items;
+    }
+
+    // Uniform points on a 4000 x 2000 plane with costs in [10, 2000), like the course instances
+    std::vector<std::vector<int>> syntheticInstance(int size, uint64_t seed) {
+        RunRng rng(seed, static_cast<uint64_t>(size));
+        std::vector<std::vector<int>> data(size);
+        for (auto &row : data)
+            row = {static_cast<int>(rng() % 4000), static_cast<int>(rng() % 2000), static_cast<int>(10 + rng() % 1990)};
+        return data;
+    }
+
+    void microBenchmarks(const BenchmarkConfig &config, int size, std::vector<BenchmarkStats> &results) {
+        std::vector<std::vector<int>> data = syntheticInstance(size, config.seed);
+        DataManager instance(data);
+        int **distanceMatrix = instance.getDistanceMatrix();
+        const std::vector<int> &costVector = instance.getCostVector();
+
+        RunRng rng(config.seed, 0);
+        std::vector<int> tour = randomPermutation(size, rng);
+        int n = static_cast<int>(tour.size());
+        std::vector<int> pos(size, -1);
+        for (int i = 0; i < n; ++i) pos[tour[i]] = i;
+
+        const int batch = 1000;
+        std::vector<std::pair<int, int>> pairs(batch);
+        for (auto &p : pairs) p = {static_cast<int>(rng() % n), static_cast<int>(rng() % n)};
+
+        results.push_back(runBenchmark("micro", "evaluateSolution", size, config.warmup, config.repetitions, batch, [&]() {
+            for (int k = 0; k < batch; ++k)
+                doNotOptimize(evaluateSolution(tour, distanceMatrix, costVector));
+        }));
+
+        results.push_back(runBenchmark("micro", "getEuclidanDistance", size, config.warmup, config.repetitions, batch, [&]() {
+            for (const auto &p : pairs)
+                doNotOptimize(instance.getEuclidanDistance(data[p.first][0], data[p.first][1], data[p.second][0], data[p.second][1]));
+        }));
+
+        std::vector<int> reversed = tour;
+        results.push_back(runBenchmark("micro", "reverseCircularSegment", size, config.warmup, config.repetitions, batch, [&]() {
+            for (const auto &p : pairs)
+                reverseCircularSegment(reversed, p.first, p.second);
+            doNotOptimize(reversed.front());
+        }));
+
+        results.push_back(runBenchmark("micro", "checkEdge", size, config.warmup, config.repetitions, batch, [&]() {
+            for (const auto &p : pairs)
+                doNotOptimize(checkEdge(tour[p.first], tour[p.second], tour, pos));
+        }));
+
+        results.push_back(runBenchmark("micro", "createCandidateList", size, config.warmup, config.repetitions, 1, [&]() {
+            auto candidateList = createCandidateList(distanceMatrix, costVector, size, 10);
+            doNotOptimize(candidateList.size());
+        }));
+
+        std::vector<Move> moves;
+        results.push_back(runBenchmark("micro", "generateMoves", size, config.warmup, config.repetitions, 1, [&]() {
+            moves.clear();
+            generateMoves(distanceMatrix, costVector, tour, pos, moves, true, size);
+            doNotOptimize(moves.size());
+        }));
+    }
+
+    void macroBenchmarks(const BenchmarkConfig &config, int size, std::vector<BenchmarkStats> &results) {
+        DataManager instance(syntheticInstance(size, config.seed));
+
+        MultiStartOptions options;
+        options.masterSeed = config.seed;
+        options.threads = 1;
+
+        // Single-threaded runs and scans, so a group on this thread counts everything a method does,
+        // except for the methods that start threads of their own
+        std::unique_ptr<PerfCounterGroup> perf;
+        if (config.perf) {
+            perf = std::make_unique<PerfCounterGroup>();
+            options.scanThreads = 1;
+        }
+
+        for (const auto &entry : getMethodRegistry()) {
+            if (!config.methods.empty() && std::find(config.methods.begin(), config.methods.end(), entry.first) == config.methods.end())
+                continue;
+            // Only parameters the method reads are overridden, and they name the variant
+            ExperimentParams params = entry.second.defaults;
+            std::string name = entry.first;
+            for (const auto &param : config.params) {
+                if (!params.count(param.first)) continue;
+                params[param.first] = param.second;
+                std::ostringstream label;
+                label << param.first << "=" << param.second;
+                name += (name == entry.first ? "[" : ",") + label.str();
+            }
+            if (name != entry.first) name += "]";
+            std::cerr << "  " << name << " (n=" << size << ")" << std::endl;
+            bool counted = perf && methodThreads(params) == 1;
+            if (perf && !counted)
+                std::cerr << "    runs on " << methodThreads(params) << " threads; no hardware counters" << std::endl;
+
+            // Every repetition starts cold: memoized greedy starts and local optima would otherwise turn M2/M4 into lookups
+            MultiStartResult last;
+            PerfSample hardware;
+            int invocations = 0;
+            BenchmarkStats stats = runBenchmark("macro", name, size, config.warmup, config.repetitions, config.runs, [&]() {
+                ConstructionCache::shared().clear();
+                KnownOptima::clearShared();
+                InstanceCache::shared().clear();
+                if (counted) perf->start();
+                last = entry.second.run(instance, params, config.runs, options);
+                if (counted) hardware.add(perf->stop());
+                invocations++;
+            });
+            stats.extra = {{"bestObjective", static_cast<double>(last.bestObjective)}, {"avgObjective", last.averageObjective()}};
+
+            // Hardware events per run, and per scored move when the search counters are compiled in
+            double runs = static_cast<double>(invocations) * config.runs;
+            double moves = movesEvaluated(last) * invocations;
+            for (int e = 0; e < PerfSample::EventCount; ++e) {
+                if (!hardware.available[e]) continue;
+                stats.extra.push_back({std::string(PerfSample::name(e)) + "PerRun", hardware.values[e] / runs});
+                if (moves > 0)
+                    stats.extra.push_back({std::string(PerfSample::name(e)) + "PerMove", hardware.values[e] / moves});
+            }
+            if (hardware.available[PerfSample::Cycles] && hardware.available[PerfSample::Instructions] && hardware.values[PerfSample::Cycles] > 0)
+                stats.extra.push_back({"ipc", static_cast<double>(hardware.values[PerfSample::Instructions]) / hardware.values[PerfSample::Cycles]});
+            results.push_back(stats);
+        }
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    BenchmarkConfig config;
+    bool onlyMicro = false, onlyMacro = false;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--micro") { onlyMicro = true; continue; }
+        if (arg == "--macro") { onlyMacro = true; continue; }
+        if (arg == "--perf") { config.perf = true; continue; }
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for " << arg << std::endl;
+            return 1;
+        }
+        std::string value = argv[++i];
+
+        if (arg == "--sizes") {
+            config.sizes.clear();
+            for (const auto &item : splitList(value)) config.sizes.push_back(std::atoi(item.c_str()));
+        } else if (arg == "--methods") {
+            config.methods = splitList(value);
+        } else if (arg == "--reps") {
+            config.repetitions = std::max(1, std::atoi(value.c_str()));
+        } else if (arg == "--warmup") {
+            config.warmup = std::max(0, std::atoi(value.c_str()));
+        } else if (arg == "--runs") {
+            config.runs = std::max(1, std::atoi(value.c_str()));
+        } else if (arg == "--seed") {
+            config.seed = std::strtoull(value.c_str(), nullptr, 10);
+        } else if (arg == "--param") {
+            size_t eq = value.find('=');
+            if (eq == std::string::npos || eq == 0) {
+                std::cerr << "Invalid parameter (expected name=value): " << value << std::endl;
+                return 1;
+            }
+            config.params[value.substr(0, eq)] = std::atof(value.substr(eq + 1).c_str());
+        } else if (arg == "--output") {
+            config.output = value;
+        } else {
+            std::cerr << "Unknown option: " << arg << std::endl;
+            return 1;
+        }
+    }
+    // Naming one layer runs only that layer; naming both (or neither) runs both
+    if (onlyMicro != onlyMacro) {
+        config.micro = onlyMicro;
+        config.macro = onlyMacro;
+    }
+
+    if (config.perf && !PerfCounterGroup().isAvailable())
+        std::cerr << "Hardware counters are unavailable (perf_event_open refused); reporting timings only" << std::endl;
+
+    std::vector<BenchmarkStats> results;
+    for (int size : config.sizes) {
+        if (size < 4) continue;
+        if (config.micro) {
+            std::cerr << "micro-benchmarks (n=" << size << ")" << std::endl;
+            microBenchmarks(config, size, results);
+        }
+        if (config.macro) {
+            std::cerr << "macro-benchmarks (n=" << size << ")" << std::endl;
+            macroBenchmarks(config, size, results);
+        }
+    }
+
+    std::ofstream file;
+    if (!config.output.empty()) {
+        file.open(config.output);
+        if (!file.is_open()) {
+            std::cerr << "Error: Could not write the output file: " << config.output << std::endl;
+            return 1;
+        }
+    }
+    std::ostream &out = config.output.empty() ? std::cout : file;
+
+    out << "{\"seed\":" << config.seed << ",\"repetitions\":" << config.repetitions << ",\"warmup\":" << config.warmup
+        << ",\"runsPerRepetition\":" << config.runs << ",\"benchmarks\":[\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+        out << "  ";
+        writeBenchmarkJson(out, results[i]);
+        out << (i + 1 < results.size() ? ",\n" : "\n");
+    }
+    out << "]}" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,87 @@
+#ifndef BENCHMARK_HARNESS_H
+#define BENCHMARK_HARNESS_H
+
+#include <vector>
+#include <string>
+#include <cmath>
+#include <chrono>
+#include <ostream>
+#include <algorithm>
+
+/**
+ * @brief Minimal timing harness for benchmark.cpp.
+ * A benchmark is a callable executed `warmup` times untimed and then `repetitions`
+ * times timed; each repetition performs `opsPerRepetition` operations, so
+ * micro-benchmarks can batch many cheap calls into one clock read.
+ * Results are reported as nanoseconds per operation with order statistics.
+ */
+struct BenchmarkStats {
+    std::string group;      // "micro" or "macro"
+    std::string name;
+    int size = 0;           // instance size the benchmark ran on
+    int repetitions = 0;
+    long long opsPerRepetition = 1;
+    double minNs = 0, medianNs = 0, p90Ns = 0, p99Ns = 0, maxNs = 0, meanNs = 0;
+    std::vector<std::pair<std::string, double>> extra; // benchmark-specific values, e.g. the best objective
+};
+
+// Nearest-rank percentile of an ascending sample: the smallest value with at least p% of the sample at or below it
+inline double percentile(const std::vector<double> &sorted, double p) {
+    if (sorted.empty()) return 0.0;
+    double rank = std::ceil(p / 100.0 * static_cast<double>(sorted.size()));
+    size_t index = rank > 1.0 ? static_cast<size_t>(rank) - 1 : 0;
+    return sorted[std::min(index, sorted.size() - 1)];
+}
+
+// Keeps a value alive so the optimizer cannot drop the computation producing it
+template <typename T>
+inline void doNotOptimize(const T &value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+template <typename Fn>
+BenchmarkStats runBenchmark(const std::string &group, const std::string &name, int size, int warmup, int repetitions,
+                            long long opsPerRepetition, Fn fn) {
+    for (int i = 0; i < warmup; ++i)
+        fn();
+
+    std::vector<double> samples;
+    samples.reserve(repetitions);
+    for (int i = 0; i < repetitions; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        auto end = std::chrono::steady_clock::now();
+        samples.push_back(std::chrono::duration<double, std::nano>(end - start).count() / opsPerRepetition);
+    }
+    std::sort(samples.begin(), samples.end());
+
+    BenchmarkStats stats;
+    stats.group = group;
+    stats.name = name;
+    stats.size = size;
+    stats.repetitions = repetitions;
+    stats.opsPerRepetition = opsPerRepetition;
+    if (!samples.empty()) {
+        double sum = 0;
+        for (double s : samples) sum += s;
+        stats.minNs = samples.front();
+        stats.maxNs = samples.back();
+        stats.meanNs = sum / samples.size();
+        stats.medianNs = percentile(samples, 50);
+        stats.p90Ns = percentile(samples, 90);
+        stats.p99Ns = percentile(samples, 99);
+    }
+    return stats;
+}
+
+inline void writeBenchmarkJson(std::ostream &out, const BenchmarkStats &stats) {
+    out << "{\"group\":\"" << stats.group << "\",\"name\":\"" << stats.name << "\",\"size\":" << stats.size
+        << ",\"repetitions\":" << stats.repetitions << ",\"opsPerRepetition\":" << stats.opsPerRepetition
+        << ",\"minNs\":" << stats.minNs << ",\"medianNs\":" << stats.medianNs << ",\"p90Ns\":" << stats.p90Ns
+        << ",\"p99Ns\":" << stats.p99Ns << ",\"maxNs\":" << stats.maxNs << ",\"meanNs\":" << stats.meanNs;
+    for (const auto &value : stats.extra)
+        out << ",\"" << value.first << "\":" << value.second;
+    out << "}";
+}
+
+#endif
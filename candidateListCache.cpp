@@ -0,0 +1,56 @@
+#include "candidateListCache.h"
+
+CandidateListCache& CandidateListCache::shared() {
+    static CandidateListCache cache;
+    return cache;
+}
+
+CandidateListCache::CandidateList CandidateListCache::getOrBuild(int **distanceMatrix, const std::vector<int>& costVector, int K,
+                                                                 const std::function<CandidateList()>& build) {
+    Key key(distanceMatrix, costVector.data(), costVector.size(), K);
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        auto it = this->entries.find(key);
+        if (it != this->entries.end())
+            return it->second;
+    }
+
+    // Built outside the lock; two threads racing on the same key produce the same lists anyway
+    CandidateList candidateList = build();
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->entries[key] = candidateList;
+    return candidateList;
+}
+
+void CandidateListCache::update(int **previousMatrix, int **distanceMatrix, const std::vector<int>& costVector,
+                                const std::function<void(int, CandidateList&)>& fn) {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    std::vector<std::pair<int, CandidateList>> updated;
+    for (auto it = this->entries.begin(); it != this->entries.end();) {
+        if (std::get<0>(it->first) == previousMatrix) {
+            updated.push_back({std::get<3>(it->first), std::move(it->second)});
+            it = this->entries.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    for (auto& entry : updated) {
+        fn(entry.first, entry.second);
+        this->entries[Key(distanceMatrix, costVector.data(), costVector.size(), entry.first)] = std::move(entry.second);
+    }
+}
+
+void CandidateListCache::forget(int **distanceMatrix) {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    for (auto it = this->entries.begin(); it != this->entries.end();) {
+        if (std::get<0>(it->first) == distanceMatrix)
+            it = this->entries.erase(it);
+        else
+            ++it;
+    }
+}
+
+void CandidateListCache::clear() {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->entries.clear();
+}
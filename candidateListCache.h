@@ -0,0 +1,48 @@
+#ifndef CANDIDATE_LIST_CACHE_H
+#define CANDIDATE_LIST_CACHE_H
+
+#include <map>
+#include <mutex>
+#include <atomic>
+#include <tuple>
+#include <vector>
+#include <functional>
+
+/**
+ * @brief Memo of candidate lists for instances that stay resident in memory.
+ * Off by default: a process that solves each instance once gains nothing,
+ * and entries are keyed by the addresses of the distance matrix and cost
+ * vector, which are only stable while their DataManager lives. The solver
+ * daemon enables it and calls forget() before it drops an instance;
+ * createCandidateList then builds each (instance, K) list once. Changes made
+ * in place (warmStart.h) go through update(), which also files the lists
+ * under the new addresses and size of an instance that grew.
+ */
+class CandidateListCache {
+public:
+    using CandidateList = std::vector<std::vector<int>>;
+
+    static CandidateListCache& shared();
+
+    void enable() { enabled = true; }
+    bool isEnabled() const { return enabled; }
+
+    CandidateList getOrBuild(int **distanceMatrix, const std::vector<int>& costVector, int K,
+                             const std::function<CandidateList()>& build);
+    // Calls fn(K, lists) on every cached list of the instance whose distance matrix was previousMatrix,
+    // which now has this distance matrix and cost vector
+    void update(int **previousMatrix, int **distanceMatrix, const std::vector<int>& costVector,
+                const std::function<void(int, CandidateList&)>& fn);
+    // Drops every list of the instance with this distance matrix
+    void forget(int **distanceMatrix);
+    void clear();
+
+private:
+    using Key = std::tuple<int **, const int *, size_t, int>;
+
+    std::map<Key, CandidateList> entries;
+    std::mutex mutex;
+    std::atomic<bool> enabled{false};
+};
+
+#endif
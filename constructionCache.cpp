@@ -0,0 +1,126 @@
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <sstream>
+#include <tuple>
+
+#include "constructionCache.h"
+
+ConstructionCache& ConstructionCache::shared() {
+    static ConstructionCache cache;
+    return cache;
+}
+
+// FNV-1a over the size, the cost vector and the full distance matrix
+uint64_t ConstructionCache::hashInstance(int **distanceMatrix, const std::vector<int>& costVector, int size) {
+    uint64_t hash = 1469598103934665603ULL;
+    auto mix = [&hash](int value) {
+        uint32_t bits = static_cast<uint32_t>(value);
+        for (int b = 0; b < 4; ++b) {
+            hash ^= (bits >> (8 * b)) & 0xFF;
+            hash *= 1099511628211ULL;
+        }
+    };
+
+    mix(size);
+    for (int i = 0; i < size; ++i)
+        mix(costVector[i]);
+    for (int i = 0; i < size; ++i)
+        for (int j = 0; j < size; ++j)
+            mix(distanceMatrix[i][j]);
+    return hash;
+}
+
+bool ConstructionCache::Key::operator<(const Key& other) const {
+    return std::tie(instanceHash, constructor, startNode) < std::tie(other.instanceHash, other.constructor, other.startNode);
+}
+
+bool ConstructionCache::lookup(uint64_t instanceHash, const std::string& constructor, int startNode, std::vector<int>& solution) {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    auto it = this->entries.find({instanceHash, constructor, startNode});
+    if (it == this->entries.end()) {
+        this->misses++;
+        return false;
+    }
+    this->hits++;
+    solution = it->second;
+    return true;
+}
+
+void ConstructionCache::store(uint64_t instanceHash, const std::string& constructor, int startNode, const std::vector<int>& solution) {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->entries[{instanceHash, constructor, startNode}] = solution;
+}
+
+std::vector<int> ConstructionCache::getOrBuild(uint64_t instanceHash, const std::string& constructor, int startNode,
+                                               const std::function<std::vector<int>()>& build) {
+    std::vector<int> solution;
+    if (lookup(instanceHash, constructor, startNode, solution))
+        return solution;
+
+    // Built outside the lock; two threads racing on the same key produce the same route anyway
+    solution = build();
+    store(instanceHash, constructor, startNode, solution);
+    return solution;
+}
+
+void ConstructionCache::clear() {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->entries.clear();
+    this->hits = 0;
+    this->misses = 0;
+}
+
+// File format, one entry per line: hash;constructor;startNode;node node node ...
+bool ConstructionCache::loadFromFile(const std::string& filename) {
+    std::ifstream file(filename);
+    if (!file.is_open())
+        return false;
+
+    std::string line;
+    while (std::getline(file, line)) {
+        std::stringstream ss(line);
+        std::string hashField, constructor, startField, route;
+        if (!std::getline(ss, hashField, ';') || !std::getline(ss, constructor, ';') ||
+            !std::getline(ss, startField, ';') || !std::getline(ss, route)) {
+            std::cerr << "Invalid cache entry: " << line << std::endl;
+            return false;
+        }
+
+        std::vector<int> solution;
+        std::stringstream routeStream(route);
+        int node;
+        while (routeStream >> node)
+            solution.push_back(node);
+
+        try {
+            store(std::stoull(hashField), constructor, std::stoi(startField), solution);
+        } catch (const std::exception& e) {
+            std::cerr << "Invalid cache entry: " << line << std::endl;
+            return false;
+        }
+    }
+
+    file.close();
+    return true;
+}
+
+bool ConstructionCache::saveToFile(const std::string& filename) {
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        std::cerr << "Error: Could not write the cache file: " << filename << std::endl;
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(this->mutex);
+    for (const auto& entry : this->entries) {
+        file << entry.first.instanceHash << ";" << entry.first.constructor << ";" << entry.first.startNode << ";";
+        for (size_t i = 0; i < entry.second.size(); ++i)
+            file << (i > 0 ? " " : "") << entry.second[i];
+        file << "\n";
+    }
+
+    file.close();
+    return true;
+}
@@ -0,0 +1,51 @@
+#ifndef CONSTRUCTION_CACHE_H
+#define CONSTRUCTION_CACHE_H
+
+#include <vector>
+#include <map>
+#include <mutex>
+#include <string>
+#include <cstdint>
+#include <functional>
+
+/**
+ * @brief Memo of deterministic start solutions.
+ * Greedy constructions (and steepest descent started from them) depend only
+ * on the instance and the start node, so a run that draws an already seen
+ * start node can reuse the stored route instead of rebuilding it.
+ * Entries are keyed by (instance hash, constructor tag, start node). The tag
+ * names the constructor and any parameter it depends on, e.g. "greedyWeightedRegret:0.5".
+ */
+class ConstructionCache {
+public:
+    static ConstructionCache& shared();
+    static uint64_t hashInstance(int **distanceMatrix, const std::vector<int>& costVector, int size);
+
+    bool lookup(uint64_t instanceHash, const std::string& constructor, int startNode, std::vector<int>& solution);
+    void store(uint64_t instanceHash, const std::string& constructor, int startNode, const std::vector<int>& solution);
+    std::vector<int> getOrBuild(uint64_t instanceHash, const std::string& constructor, int startNode,
+                                const std::function<std::vector<int>()>& build);
+
+    void clear();
+
+    bool loadFromFile(const std::string& filename);
+    bool saveToFile(const std::string& filename);
+
+    size_t getHits() const { return hits; }
+    size_t getMisses() const { return misses; }
+
+private:
+    struct Key {
+        uint64_t instanceHash;
+        std::string constructor;
+        int startNode;
+        bool operator<(const Key& other) const;
+    };
+
+    std::map<Key, std::vector<int>> entries;
+    std::mutex mutex;
+    size_t hits = 0;
+    size_t misses = 0;
+};
+
+#endif
@@ -0,0 +1,431 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <random>
+#include <limits>
+#include <climits>
+#include <cstdint>
+
+#include "constructors.h"
+#include "constructionCache.h"
+#include "instanceCache.h"
+#include "tourUtils.h"
+
+// Random solution algorithm
+MultiStartResult randomSolution(int **distanceMatrix, const std::vector<int> &costVector, int dataSize, int totalRuns,
+                                const MultiStartOptions &options)
+{
+    if (dataSize <= 0) return MultiStartResult();
+    int numberOfNodesToVisit = getNodesToVisit(dataSize);
+    MultiStartResult result = runMultiStart(totalRuns, [&](int run, RunRng &rng) -> RunResult
+    {
+        std::uniform_int_distribution<int> nodeDist(0, dataSize - 1);
+        std::vector<int> currentSolution;
+        while (static_cast<int>(currentSolution.size()) < numberOfNodesToVisit)
+        {
+            int randomNode = nodeDist(rng);
+            if (std::find(currentSolution.begin(), currentSolution.end(), randomNode) == currentSolution.end())
+            {
+                currentSolution.push_back(randomNode);
+            }
+        }
+        int currentScore = evaluateSolution(currentSolution, distanceMatrix, costVector);
+        return {currentScore, currentSolution};
+    }, options);
+
+    return result;
+}
+
+// Nearest Neighbour algorithm (only adding at the end)
+int getBestNearestNeighbour(int currentNode, const std::vector<int> &unvisitedNodes, int **distanceMatrix, const std::vector<int> &costVector)
+{
+    int bestNode = -1;
+    int bestScore = INT_MAX;
+    for (const auto &node : unvisitedNodes)
+    {
+        if (distanceMatrix[currentNode][node] + costVector[node] < bestScore)
+        {
+            bestScore = distanceMatrix[currentNode][node] + costVector[node];
+            bestNode = node;
+        }
+    }
+
+    return bestNode;
+}
+
+MultiStartResult nearestNeighbourSolutionOnlyAtEnd(int **distanceMatrix, const std::vector<int> &costVector, int dataSize, int totalRuns,
+                                                   const MultiStartOptions &options)
+{
+    if (dataSize <= 0) return MultiStartResult();
+    int numberOfNodesToVisit = getNodesToVisit(dataSize);
+    MultiStartResult result = runMultiStart(totalRuns, [&](int run, RunRng &rng) -> RunResult
+    {
+        std::uniform_int_distribution<int> nodeDist(0, dataSize - 1);
+        std::vector<int> currentSolution;
+        int startingNode = nodeDist(rng);
+        currentSolution.push_back(startingNode);
+
+        std::vector<int> unvisitedNodes;
+        for (int j = 0; j < dataSize; j++)
+        {
+            if (j != startingNode)
+            {
+                unvisitedNodes.push_back(j);
+            }
+        }
+
+        while (static_cast<int>(currentSolution.size()) < numberOfNodesToVisit)
+        {
+            int nextNode = getBestNearestNeighbour(currentSolution.back(), unvisitedNodes, distanceMatrix, costVector);
+            if (nextNode != -1)
+            {
+                currentSolution.push_back(nextNode);
+                unvisitedNodes.erase(std::remove(unvisitedNodes.begin(), unvisitedNodes.end(), nextNode), unvisitedNodes.end());
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        int currentScore = evaluateSolution(currentSolution, distanceMatrix, costVector);
+        return {currentScore, currentSolution};
+    }, options);
+
+    return result;
+}
+
+MultiStartResult nearestNeighbourSolution(int **distanceMatrix, const std::vector<int> &nodeCostVector, int numberOfNodes, int numberOfSolutionsPerStart,
+                                         const MultiStartOptions &options)
+{
+    if (numberOfNodes <= 0)
+        return MultiStartResult();
+
+    int nodesToVisit = getNodesToVisit(numberOfNodes);
+
+    // Run a fixed number of constructions (avoid multiplying by numberOfNodes)
+    int totalRuns = numberOfSolutionsPerStart; // <<< use same scale as M6
+    MultiStartResult result = runMultiStart(totalRuns, [&](int run, RunRng &rng) -> RunResult
+    {
+        std::uniform_int_distribution<int> startDist(0, numberOfNodes - 1);
+        int startNode = startDist(rng);
+
+        std::vector<int> routeNodes;
+        routeNodes.reserve(nodesToVisit);
+        std::vector<char> isNodeUsed(numberOfNodes, 0);
+
+        routeNodes.push_back(startNode);
+        isNodeUsed[startNode] = 1;
+
+        while ((int)routeNodes.size() < nodesToVisit)
+        {
+            int bestObjectiveDelta = std::numeric_limits<int>::max();
+            std::vector<int> candidates;
+
+            for (int candidateNode = 0; candidateNode < numberOfNodes; ++candidateNode)
+            {
+                if (isNodeUsed[candidateNode])
+                    continue;
+
+                for (size_t insertionPosition = 0; insertionPosition <= routeNodes.size(); ++insertionPosition)
+                {
+                    int predecessorNode = (insertionPosition == 0) ? -1 : routeNodes[insertionPosition - 1];
+                    int successorNode = (insertionPosition == routeNodes.size()) ? -1 : routeNodes[insertionPosition];
+
+                    int addedDistance = 0;
+                    if (predecessorNode != -1)
+                        addedDistance += distanceMatrix[predecessorNode][candidateNode];
+                    if (successorNode != -1)
+                        addedDistance += distanceMatrix[candidateNode][successorNode];
+
+                    int removedDistance = 0;
+                    if (predecessorNode != -1 && successorNode != -1)
+                        removedDistance = distanceMatrix[predecessorNode][successorNode];
+
+                    int objectiveDelta = nodeCostVector[candidateNode] + (addedDistance - removedDistance);
+
+                    if (objectiveDelta < bestObjectiveDelta)
+                    {
+                        bestObjectiveDelta = objectiveDelta;
+                        candidates.clear();
+                        candidates.push_back(static_cast<int>(insertionPosition) << 24 | candidateNode);
+                    }
+                    else if (objectiveDelta == bestObjectiveDelta)
+                    {
+                        candidates.push_back(static_cast<int>(insertionPosition) << 24 | candidateNode);
+                    }
+                }
+            }
+
+            if (candidates.empty())
+                break;
+
+            std::uniform_int_distribution<int> pick(0, (int)candidates.size() - 1);
+            int chosen = candidates[pick(rng)];
+            int chosenInsertion = (chosen >> 24) & 0xFF;
+            int chosenCandidate = chosen & 0xFFFFFF;
+
+            routeNodes.insert(routeNodes.begin() + chosenInsertion, chosenCandidate);
+            isNodeUsed[chosenCandidate] = 1;
+        }
+
+        int objectiveValue = evaluateSolution(routeNodes, distanceMatrix, nodeCostVector);
+
+        return {objectiveValue, routeNodes};
+    }, options);
+
+    return result;
+}
+
+// new helper: greedy insertion start (reuse in M6)
+std::vector<int> constructGreedyInsertion(int **distanceMatrix, const std::vector<int> &costVector, int size, int startNode)
+{
+    // Nearest-neighbour insertion (single run, build a linear route using insertion positions 0..sz)
+    // - select unused node with minimal distance to any node in current route (tie-break by cost then id)
+    // - insert that node at the linear position (0..sz) that minimizes objective delta
+    std::vector<int> solution;
+    if (size <= 0) return solution;
+
+    int nodesToVisit = getNodesToVisit(size);
+
+    solution.reserve(nodesToVisit);
+    solution.push_back(startNode);
+
+    std::vector<char> used(size, 0);
+    used[startNode] = 1;
+
+    while ((int)solution.size() < nodesToVisit)
+    {
+        int bestCandidate = -1;
+        int bestNearest = std::numeric_limits<int>::max();
+
+        // choose candidate by nearest distance to any node in current route
+        for (int candidate = 0; candidate < size; ++candidate)
+        {
+            if (used[candidate]) continue;
+
+            int nearest = std::numeric_limits<int>::max();
+            for (int v : solution)
+                nearest = std::min(nearest, distanceMatrix[candidate][v]);
+
+            if (bestCandidate == -1 ||
+                nearest < bestNearest ||
+                (nearest == bestNearest &&
+                 (costVector[candidate] < costVector[bestCandidate] ||
+                  (costVector[candidate] == costVector[bestCandidate] && candidate < bestCandidate))))
+            {
+                bestNearest = nearest;
+                bestCandidate = candidate;
+            }
+        }
+
+        if (bestCandidate == -1) break;
+
+        // choose best linear insertion position 0..sz (predecessor/successor logic like nearestNeighbourSolution)
+        int sz = static_cast<int>(solution.size());
+        int bestPos = 0;
+        int bestDelta = std::numeric_limits<int>::max();
+
+        for (int insertPos = 0; insertPos <= sz; ++insertPos)
+        {
+            int predecessor = (insertPos == 0) ? -1 : solution[insertPos - 1];
+            int successor = (insertPos == sz) ? -1 : solution[insertPos];
+
+            int addedDistance = 0;
+            if (predecessor != -1) addedDistance += distanceMatrix[predecessor][bestCandidate];
+            if (successor != -1) addedDistance += distanceMatrix[bestCandidate][successor];
+
+            int removedDistance = 0;
+            if (predecessor != -1 && successor != -1) removedDistance = distanceMatrix[predecessor][successor];
+
+            int delta = costVector[bestCandidate] + (addedDistance - removedDistance);
+
+            if (delta < bestDelta || (delta == bestDelta && insertPos < bestPos))
+            {
+                bestDelta = delta;
+                bestPos = insertPos;
+            }
+        }
+
+        solution.insert(solution.begin() + bestPos, bestCandidate);
+        used[bestCandidate] = 1;
+    }
+
+    return solution;
+}
+
+// greedy insertion start memoized per (instance, start node), shared by M2/M4/M6/M8
+std::vector<int> cachedGreedyInsertion(int **distanceMatrix, const std::vector<int> &costVector, int size, int startNode, uint64_t instanceHash)
+{
+    return ConstructionCache::shared().getOrBuild(instanceHash, "constructGreedyInsertion", startNode,
+        [&]() { return constructGreedyInsertion(distanceMatrix, costVector, size, startNode); });
+}
+
+MultiStartResult greedy2Regret(int **distanceMatrix, const std::vector<int> &nodeCostVector, int numberOfNodes, int totalRuns,
+                               const MultiStartOptions &options)
+{
+    if (numberOfNodes <= 0)
+        return MultiStartResult();
+    int nodesToVisit = getNodesToVisit(numberOfNodes);
+
+    // The construction is deterministic given the start node, so repeated starts come from the cache
+    uint64_t instanceHash = InstanceCache::shared().hash(distanceMatrix, nodeCostVector, numberOfNodes);
+
+    MultiStartResult result = runMultiStart(totalRuns, [&](int run, RunRng &rng) -> RunResult
+    {
+        std::uniform_int_distribution<int> startDist(0, numberOfNodes - 1);
+        int startNode = startDist(rng);
+        std::vector<int> routeNodes = ConstructionCache::shared().getOrBuild(instanceHash, "greedy2Regret", startNode, [&]()
+        {
+            std::vector<int> routeNodes;
+            std::vector<char> isNodeUsed(numberOfNodes, 0);
+
+            routeNodes.push_back(startNode);
+            isNodeUsed[startNode] = 1;
+
+            while ((int)routeNodes.size() < nodesToVisit)
+            {
+                int bestNode = -1;
+                int bestInsertionPos = -1;
+                int maxRegret = std::numeric_limits<int>::min();
+                int bestCost = std::numeric_limits<int>::max();
+
+                for (int candidateNode = 0; candidateNode < numberOfNodes; ++candidateNode)
+                {
+                    if (isNodeUsed[candidateNode])
+                        continue;
+
+                    std::vector<std::pair<int, int>> insertionData; // {cost, pos}
+
+                    for (size_t pos = 0; pos <= routeNodes.size(); ++pos)
+                    {
+                        int pred = (pos == 0) ? routeNodes.back() : routeNodes[pos - 1];
+                        int succ = (pos == routeNodes.size()) ? routeNodes.front() : routeNodes[pos];
+
+                        int added = distanceMatrix[pred][candidateNode] + distanceMatrix[candidateNode][succ];
+                        int removed = (pred != succ) ? distanceMatrix[pred][succ] : 0;
+
+                        // include cost of connecting to start if closing the cycle early
+                        if (static_cast<int>(routeNodes.size()) == numberOfNodes - 1)
+                        {
+                            added += distanceMatrix[candidateNode][routeNodes.front()];
+                            removed += distanceMatrix[routeNodes.back()][routeNodes.front()];
+                        }
+
+                        int cost = nodeCostVector[candidateNode] + (added - removed);
+                        insertionData.push_back({cost, (int)pos});
+                    }
+
+                    std::sort(insertionData.begin(), insertionData.end());
+                    int bestInsertionCost = insertionData[0].first;
+                    int regret = (insertionData.size() > 1) ? (insertionData[1].first - insertionData[0].first) : insertionData[0].first;
+
+                    if (regret > maxRegret || (regret == maxRegret && bestInsertionCost < bestCost))
+                    {
+                        maxRegret = regret;
+                        bestCost = bestInsertionCost;
+                        bestNode = candidateNode;
+                        bestInsertionPos = insertionData[0].second;
+                    }
+                }
+
+                if (bestNode == -1 || bestInsertionPos == -1)
+                    break;
+
+                routeNodes.insert(routeNodes.begin() + bestInsertionPos, bestNode);
+                isNodeUsed[bestNode] = 1;
+            }
+            return routeNodes;
+        });
+
+        // Compute total cost including closing edge
+        int totalCost = 0;
+        for (size_t i = 0; i < routeNodes.size(); ++i)
+        {
+            totalCost += nodeCostVector[routeNodes[i]];
+            totalCost += distanceMatrix[routeNodes[i]][routeNodes[(i + 1) % routeNodes.size()]]; // closing edge
+        }
+
+        return {totalCost, routeNodes};
+    }, options);
+
+    return result;
+}
+
+MultiStartResult greedyWeightedRegret(int** distanceMatrix, const std::vector<int>& nodeCostVector, 
+                                      int numberOfNodes, double alpha, int totalRuns, const MultiStartOptions& options) {
+
+    if (numberOfNodes <= 0) return MultiStartResult();
+    
+    int nodesToVisit = getNodesToVisit(numberOfNodes);
+
+    uint64_t instanceHash = InstanceCache::shared().hash(distanceMatrix, nodeCostVector, numberOfNodes);
+    std::string cacheTag = "greedyWeightedRegret:" + std::to_string(alpha);
+
+    MultiStartResult result = runMultiStart(totalRuns, [&](int run, RunRng &rng) -> RunResult {
+        std::uniform_int_distribution<int> startDist(0, numberOfNodes - 1);
+        int startNode = startDist(rng);
+        std::vector<int> routeNodes = ConstructionCache::shared().getOrBuild(instanceHash, cacheTag, startNode, [&]() {
+            std::vector<int> routeNodes;
+            std::vector<char> isNodeUsed(numberOfNodes, 0);
+
+            routeNodes.push_back(startNode);
+            isNodeUsed[startNode] = 1;
+
+            while ((int)routeNodes.size() < nodesToVisit) {
+                int bestNode = -1;
+                int bestInsertionPos = -1;
+                double bestWeightedScore = std::numeric_limits<double>::lowest();
+
+                for (int candidateNode = 0; candidateNode < numberOfNodes; ++candidateNode) {
+                    if (isNodeUsed[candidateNode]) continue;
+
+                    std::vector<std::pair<int, int>> insertionData; // {cost, pos}
+
+                    for (size_t pos = 0; pos <= routeNodes.size(); ++pos) {
+                        int pred = (pos == 0) ? routeNodes.back() : routeNodes[pos - 1];
+                        int succ = (pos == routeNodes.size()) ? routeNodes.front() : routeNodes[pos];
+
+                        int added = distanceMatrix[pred][candidateNode] + distanceMatrix[candidateNode][succ];
+                        int removed = (pred != succ) ? distanceMatrix[pred][succ] : 0;
+
+                        int cost = nodeCostVector[candidateNode] + (added - removed);
+                        insertionData.push_back({cost, (int)pos});
+                    }
+
+                    std::sort(insertionData.begin(), insertionData.end());
+                    
+                    int bestInsertionCost = insertionData[0].first;
+                    int regret = (insertionData.size() > 1)
+                        ? (insertionData[1].first - insertionData[0].first)
+                        : bestInsertionCost;
+
+                    double weightedScore = alpha * regret - (1.0 - alpha) * bestInsertionCost;
+
+                    if (weightedScore > bestWeightedScore) {
+                        bestWeightedScore = weightedScore;
+                        bestNode = candidateNode;
+                        bestInsertionPos = insertionData[0].second;
+                    }
+                }
+
+                if (bestNode == -1 || bestInsertionPos == -1) break;
+
+                routeNodes.insert(routeNodes.begin() + bestInsertionPos, bestNode);
+                isNodeUsed[bestNode] = 1;
+            }
+            return routeNodes;
+        });
+
+        int totalCost = 0;
+        for (size_t i = 0; i < routeNodes.size(); ++i) {
+            totalCost += nodeCostVector[routeNodes[i]];
+            totalCost += distanceMatrix[routeNodes[i]][routeNodes[(i + 1) % routeNodes.size()]];
+        }
+
+        return {totalCost, routeNodes};
+    }, options);
+
+    return result;
+}
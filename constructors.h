@@ -0,0 +1,39 @@
+#ifndef CONSTRUCTORS_H
+#define CONSTRUCTORS_H
+
+#include <vector>
+#include <cstdint>
+
+#include "multiStartRunner.h"
+
+// ==================== ASSIGNMENT 1: RANDOM & NEAREST NEIGHBOUR ====================
+
+MultiStartResult randomSolution(int **distanceMatrix, const std::vector<int> &costVector, int dataSize, int totalRuns = 200,
+                                const MultiStartOptions &options = MultiStartOptions::fromEnvironment());
+
+int getBestNearestNeighbour(int currentNode, const std::vector<int> &unvisitedNodes, int **distanceMatrix, const std::vector<int> &costVector);
+
+MultiStartResult nearestNeighbourSolutionOnlyAtEnd(int **distanceMatrix, const std::vector<int> &costVector, int dataSize, int totalRuns = 200,
+                                                   const MultiStartOptions &options = MultiStartOptions::fromEnvironment());
+
+// Nearest neighbour with insertion at the best position, ties broken at random
+MultiStartResult nearestNeighbourSolution(int **distanceMatrix, const std::vector<int> &nodeCostVector, int numberOfNodes, int numberOfSolutionsPerStart = 200,
+                                         const MultiStartOptions &options = MultiStartOptions::fromEnvironment());
+
+// ==================== GREEDY INSERTION (local search starts) ====================
+
+std::vector<int> constructGreedyInsertion(int **distanceMatrix, const std::vector<int> &costVector, int size, int startNode);
+
+std::vector<int> cachedGreedyInsertion(int **distanceMatrix, const std::vector<int> &costVector, int size, int startNode, uint64_t instanceHash);
+
+// ==================== ASSIGNMENT 2: REGRET HEURISTICS ====================
+
+MultiStartResult greedy2Regret(int **distanceMatrix, const std::vector<int> &nodeCostVector, int numberOfNodes, int totalRuns = 200,
+                               const MultiStartOptions &options = MultiStartOptions::fromEnvironment());
+
+// alpha weights the 2-regret against the best insertion cost
+MultiStartResult greedyWeightedRegret(int** distanceMatrix, const std::vector<int>& nodeCostVector,
+                                      int numberOfNodes, double alpha = 0.5, int totalRuns = 200,
+                                      const MultiStartOptions& options = MultiStartOptions::fromEnvironment());
+
+#endif
@@ -1,18 +1,20 @@
 #include "dataManager.h"
+#include "instanceCache.h"
 
-#include <cstdint>
 #include <cmath>
+#include <algorithm>
 
 DataManager::DataManager(const std::vector<std::vector<int>>& inputData) {
     int size = inputData.size();
+    this->capacity = size;
     this->distanceMatrix = new int*[size];
     setDistanceMatrix(inputData, size);
     setCostVector(inputData);
 }
 
 DataManager::~DataManager() {
-    int size = costVector.size();
-    for (int i = 0; i < size; i++)
+    InstanceCache::shared().forget(distanceMatrix);
+    for (int i = 0; i < capacity; i++)
         delete[] distanceMatrix[i];
     delete[] distanceMatrix;
 }
@@ -22,9 +24,9 @@ int DataManager::getEuclidanDistance (int x1, int y1, int x2, int y2) {
     }
 
 void DataManager::setDistanceMatrix (const std::vector<std::vector<int>>& data, int& size) {
-    for (int16_t i  = 0; i < size; i++) {
+    for (int i = 0; i < size; i++) {
         this->distanceMatrix[i] = new int[size];
-        for (int16_t j = 0; j < size; j++) {
+        for (int j = 0; j < size; j++) {
             if (i == j)
                 this->distanceMatrix[i][j] = 0;
             else
@@ -36,9 +38,64 @@ void DataManager::setDistanceMatrix (const std::vector<std::vector<int>>& data,
 void DataManager::setCostVector (const std::vector<std::vector<int>>& data) {
     for (const auto& row : data) {
         this->costVector.push_back(row[2]);
+        this->xCoordinates.push_back(row[0]);
+        this->yCoordinates.push_back(row[1]);
     }
 }
 
+void DataManager::updateCost (int node, int cost) {
+    InstanceCache::shared().forget(this->distanceMatrix);
+    this->costVector[node] = cost;
+}
+
+void DataManager::moveNode (int node, int x, int y) {
+    InstanceCache::shared().forget(this->distanceMatrix);
+    this->xCoordinates[node] = x;
+    this->yCoordinates[node] = y;
+    int size = this->getSize();
+    for (int j = 0; j < size; j++) {
+        int distance = j == node ? 0 : getEuclidanDistance(x, y, this->xCoordinates[j], this->yCoordinates[j]);
+        this->distanceMatrix[node][j] = distance;
+        this->distanceMatrix[j][node] = distance;
+    }
+}
+
+void DataManager::appendNodes (const std::vector<std::vector<int>>& data) {
+    InstanceCache::shared().forget(this->distanceMatrix);
+    int size = this->getSize();
+    int grown = size + static_cast<int>(data.size());
+    if (grown > this->capacity)
+        reserve(std::max(grown, 2 * this->capacity));
+
+    setCostVector(data);
+    for (int i = size; i < grown; i++) {
+        for (int j = 0; j <= i; j++) {
+            int distance = i == j ? 0 : getEuclidanDistance(xCoordinates[i], yCoordinates[i], xCoordinates[j], yCoordinates[j]);
+            this->distanceMatrix[i][j] = distance;
+            this->distanceMatrix[j][i] = distance;
+        }
+    }
+}
+
+void DataManager::reserve (int newCapacity) {
+    int size = this->getSize();
+    int** grown = new int*[newCapacity];
+    for (int i = 0; i < newCapacity; i++) {
+        grown[i] = new int[newCapacity];
+        if (i < size)
+            std::copy(this->distanceMatrix[i], this->distanceMatrix[i] + size, grown[i]);
+    }
+    for (int i = 0; i < this->capacity; i++)
+        delete[] this->distanceMatrix[i];
+    delete[] this->distanceMatrix;
+
+    this->distanceMatrix = grown;
+    this->capacity = newCapacity;
+    this->costVector.reserve(newCapacity);
+    this->xCoordinates.reserve(newCapacity);
+    this->yCoordinates.reserve(newCapacity);
+}
+
 int DataManager::evaluateSolution (std::vector<int>& solution) {
     int totalCost = 0;
     for (size_t i = 0; i < solution.size(); ++i) {
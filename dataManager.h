@@ -1,3 +1,6 @@
+#ifndef DATA_MANAGER_H
+#define DATA_MANAGER_H
+
 #include <vector>
 
 class DataManager {
@@ -8,10 +11,25 @@ public:
     void setDistanceMatrix (const std::vector<std::vector<int>>& data, int& size);
     void setCostVector (const std::vector<std::vector<int>>& data);
     int evaluateSolution (std::vector<int>& solution);
+    // In-place changes for re-optimization (warmStart.h): O(1) for a cost, O(n) for the row and column of a moved node.
+    // They and the destructor drop what InstanceCache derived from the instance
+    void updateCost (int node, int cost);
+    void moveNode (int node, int x, int y);
+    // Appends nodes given as CSV rows (x, y, cost): O(n) for each new row and column. A matrix that outgrows
+    // its capacity is copied into one twice as large, which moves the matrix and cost vector to new addresses.
+    void appendNodes (const std::vector<std::vector<int>>& data);
     int** getDistanceMatrix() const { return distanceMatrix; }
     const std::vector<int>& getCostVector() const { return costVector; }
+    int getSize() const { return static_cast<int>(costVector.size()); }
+    int getCapacity() const { return capacity; }
 
 private:
+    void reserve (int newCapacity);
+
     int** distanceMatrix;
+    int capacity;
     std::vector<int> costVector;
-};
\ No newline at end of file
+    std::vector<int> xCoordinates, yCoordinates;
+};
+
+#endif
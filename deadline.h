@@ -0,0 +1,57 @@
+#ifndef DEADLINE_H
+#define DEADLINE_H
+
+#include <atomic>
+#include <chrono>
+
+/**
+ * @brief Amortized wall-clock deadline for the anytime mode.
+ * Search loops call expired(work) with the number of moves (or other unit
+ * operations) done since their last call; the monotonic clock is only read
+ * once `checkEvery` units have accumulated, so the check costs a decrement on
+ * the hot path and the overshoot past the deadline is bounded by one stride
+ * of work. Once the deadline was seen it stays reached without further reads.
+ *
+ * A deadline may also watch a stop flag (the target of an Incumbent), read
+ * at the same stride; Clock::time_point::max() makes it a stop-only deadline
+ * that never reads the clock. runMultiStart installs the deadline of the
+ * current run in current(); an inactive deadline (the default) never expires.
+ */
+class Deadline {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr long checkEvery = 1 << 14;
+
+    Deadline() : stop(nullptr), active(false), reachedFlag(false), budget(checkEvery) {}
+    explicit Deadline(Clock::time_point at, const std::atomic<bool> *stop = nullptr)
+        : at(at), stop(stop), active(true), reachedFlag(false), budget(checkEvery) {}
+
+    bool expired(long work = 1) {
+        if (!active) return false;
+        if (reachedFlag) return true;
+        budget -= work;
+        if (budget > 0) return false;
+        budget = checkEvery;
+        reachedFlag = (stop && stop->load(std::memory_order_relaxed)) || (at != Clock::time_point::max() && Clock::now() >= at);
+        return reachedFlag;
+    }
+
+    // True once expired() observed the deadline; a search cut short must not be reported as a local optimum
+    bool reached() const { return reachedFlag; }
+    bool isActive() const { return active; }
+
+    static Deadline &current() {
+        thread_local Deadline deadline;
+        return deadline;
+    }
+
+private:
+    Clock::time_point at;
+    const std::atomic<bool> *stop;
+    bool active;
+    bool reachedFlag;
+    long budget;
+};
+
+#endif
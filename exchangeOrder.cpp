@@ -0,0 +1,19 @@
+#include <algorithm>
+#include <climits>
+#include <numeric>
+
+#include "exchangeOrder.h"
+
+ExchangeOrder::ExchangeOrder(int **distanceMatrix, const std::vector<int> &costVector, int size)
+    : order(size), bounds(size)
+{
+    for (int v = 0; v < size; ++v) {
+        int nearest = size > 1 ? INT_MAX : 0;
+        for (int w = 0; w < size; ++w)
+            if (w != v) nearest = std::min(nearest, distanceMatrix[v][w]);
+        bounds[v] = costVector[v] + 2 * nearest;
+    }
+
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [this](int l, int r) { return bounds[l] < bounds[r]; });
+}
@@ -0,0 +1,39 @@
+#ifndef EXCHANGE_ORDER_H
+#define EXCHANGE_ORDER_H
+
+#include <vector>
+
+/**
+ * @brief All nodes sorted by the least their insertion into any tour edge
+ * can add: cost(v) plus twice the distance to v's nearest other node, since
+ * both new edges at v are at least that long (no triangle inequality is
+ * assumed, the rounded distances need not satisfy it).
+ *
+ * Replacing the selected u by v changes the objective by at least
+ * bound(v) - share(u), share(u) = cost(u) + d(prev, u) + d(u, next). An
+ * exchange scan over this order can stop at the first node whose bound
+ * rules out the delta it needs; the rest, selected or not, would do no
+ * better. Only valid for tours of at least two nodes.
+ */
+class ExchangeOrder {
+public:
+    ExchangeOrder() = default;
+    ExchangeOrder(int **distanceMatrix, const std::vector<int> &costVector, int size);
+
+    const std::vector<int> &nodes() const { return order; }
+    int bound(int v) const { return bounds[v]; }
+    bool empty() const { return order.empty(); }
+
+private:
+    std::vector<int> order;
+    std::vector<int> bounds;
+};
+
+// What the node at position i adds to the objective: its cost and both tour edges
+inline int exchangeShare(int **distanceMatrix, const std::vector<int> &costVector, const std::vector<int> &solution, int i) {
+    int n = static_cast<int>(solution.size());
+    int u = solution[i];
+    return costVector[u] + distanceMatrix[solution[(i - 1 + n) % n]][u] + distanceMatrix[u][solution[(i + 1) % n]];
+}
+
+#endif
@@ -0,0 +1,246 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#include "experimentScheduler.h"
+#include "fileReader.h"
+#include "perfCounters.h"
+
+namespace {
+    // Index of the pool worker running on this thread, -1 outside the pool
+    thread_local int currentWorker = -1;
+    thread_local const WorkStealingPool* currentPool = nullptr;
+}
+
+WorkStealingPool::WorkStealingPool(int threads) : pending(0), nextQueue(0), queued(0), stopping(false) {
+    int count = std::max(1, threads);
+    for (int i = 0; i < count; i++)
+        this->queues.push_back(std::make_unique<Queue>());
+    for (int i = 0; i < count; i++)
+        this->workers.emplace_back(&WorkStealingPool::workerLoop, this, i);
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    {
+        std::lock_guard<std::mutex> lock(this->idleMutex);
+        this->stopping = true;
+    }
+    this->idleCondition.notify_all();
+    for (auto& worker : this->workers)
+        worker.join();
+}
+
+void WorkStealingPool::submit(std::function<void()> task, bool deferred) {
+    // Tasks spawned by a worker stay on its own deque, others are dealt round-robin
+    int target = (currentPool == this) ? currentWorker : static_cast<int>(this->nextQueue++ % this->queues.size());
+
+    this->pending++;
+    {
+        std::lock_guard<std::mutex> lock(this->queues[target]->mutex);
+        if (deferred)
+            this->queues[target]->tasks.push_front(std::move(task));
+        else
+            this->queues[target]->tasks.push_back(std::move(task));
+    }
+    {
+        std::lock_guard<std::mutex> lock(this->idleMutex);
+        this->queued++;
+    }
+    this->idleCondition.notify_one();
+}
+
+void WorkStealingPool::wait() {
+    std::unique_lock<std::mutex> lock(this->idleMutex);
+    this->doneCondition.wait(lock, [this]() { return this->pending == 0; });
+}
+
+bool WorkStealingPool::popLocal(int workerId, std::function<void()>& task) {
+    Queue& queue = *this->queues[workerId];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty())
+        return false;
+    task = std::move(queue.tasks.back());
+    queue.tasks.pop_back();
+    return true;
+}
+
+bool WorkStealingPool::steal(int workerId, std::function<void()>& task) {
+    int count = static_cast<int>(this->queues.size());
+    for (int offset = 1; offset < count; offset++) {
+        Queue& queue = *this->queues[(workerId + offset) % count];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.tasks.empty())
+            continue;
+        task = std::move(queue.tasks.front());
+        queue.tasks.pop_front();
+        return true;
+    }
+    return false;
+}
+
+void WorkStealingPool::workerLoop(int workerId) {
+    currentWorker = workerId;
+    currentPool = this;
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(this->idleMutex);
+            this->idleCondition.wait(lock, [this]() { return this->stopping || this->queued > 0; });
+            if (this->queued == 0)
+                return;
+            this->queued--;
+        }
+
+        // Taking one off `queued` reserves a task for this worker, so some deque is guaranteed to hold it
+        std::function<void()> task;
+        while (!popLocal(workerId, task) && !steal(workerId, task))
+            std::this_thread::yield();
+
+        task();
+
+        if (--this->pending == 0) {
+            std::lock_guard<std::mutex> lock(this->idleMutex);
+            this->doneCondition.notify_all();
+        }
+    }
+}
+
+void runExperiment(const ExperimentSpec& spec, const std::map<std::string, ExperimentMethod>& methods,
+                   const std::function<void(const ExperimentOutcome&)>& onResult) {
+    MultiStartOptions baseOptions = MultiStartOptions::fromEnvironment();
+    int threads = (spec.threads > 0) ? spec.threads : baseOptions.threads;
+    int runsPerTask = std::max(1, spec.runsPerTask);
+    // Up to `threads` chunks run at once, each a single run, so their scan teams share the cores between them
+    int hardware = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    int chunkScanThreads = baseOptions.scanThreads > 0 ? baseOptions.scanThreads : std::max(1, hardware / threads);
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                        std::chrono::duration<double>(spec.timeLimitSeconds));
+
+    WorkStealingPool pool(threads);
+    std::mutex streamMutex;
+
+    struct Group {
+        ExperimentOutcome outcome;
+        int activeChunks;
+        int nextFirstRun = 0; // next run id to hand out in the unbounded (time-only) mode
+        std::atomic<bool> started{false};
+        std::unique_ptr<Incumbent> incumbent; // shared by all chunks, so the target stops all of them
+        std::mutex mutex;
+    };
+    using MethodIt = std::map<std::string, ExperimentMethod>::const_iterator;
+
+    bool timeLimited = spec.timeLimitSeconds > 0;
+    bool unbounded = timeLimited && spec.runs <= 0; // run until the deadline
+    if (spec.runs <= 0 && !timeLimited) {
+        std::cerr << "An experiment needs a run count or a time limit" << std::endl;
+        return;
+    }
+
+    // Runs one chunk; in the unbounded mode the chunk re-submits itself with fresh run ids until the deadline
+    std::function<void(std::shared_ptr<const DataManager>, MethodIt, std::shared_ptr<Group>, int, int)> runChunk;
+    runChunk = [&](std::shared_ptr<const DataManager> instance, MethodIt method, std::shared_ptr<Group> group, int firstRun, int chunkRuns) {
+        MultiStartResult part;
+        auto remaining = std::chrono::duration<double>(deadline - std::chrono::steady_clock::now()).count();
+        // The first chunk of a combination always runs, so every combination reports at least one run
+        bool firstChunk = !group->started.exchange(true);
+        bool expired = ((timeLimited && remaining <= 0) || group->incumbent->targetReached()) && !firstChunk;
+        if (!expired) {
+            MultiStartOptions options = baseOptions;
+            options.threads = 1;
+            options.scanThreads = chunkScanThreads;
+            options.firstRun = firstRun;
+            options.incumbent = group->incumbent.get();
+            options.timeLimitSeconds = timeLimited ? std::max(remaining, 1e-9) : 0.0; // in-flight runs stop at the experiment deadline
+            if (spec.hardwareCounters) {
+                // A chunk and its scans run single-threaded, so a group on this thread sees all of its work
+                options.scanThreads = 1;
+                PerfCounterGroup perf;
+                perf.start();
+                part = method->second(*instance, group->outcome.params, chunkRuns, options);
+                part.hardware = perf.stop();
+            } else {
+                part = method->second(*instance, group->outcome.params, chunkRuns, options);
+            }
+        }
+
+        bool resubmit = unbounded && !expired && std::chrono::steady_clock::now() < deadline && !group->incumbent->targetReached();
+        int nextFirstRun = 0;
+        bool finished = false;
+        {
+            std::lock_guard<std::mutex> lock(group->mutex);
+            if (!expired) {
+                group->outcome.result.elapsedSeconds += part.elapsedSeconds;
+                group->outcome.result.merge(std::move(part));
+            }
+            if (resubmit) {
+                nextFirstRun = group->nextFirstRun;
+                group->nextFirstRun += runsPerTask;
+            } else {
+                finished = --group->activeChunks == 0;
+            }
+        }
+        if (resubmit) {
+            // Deferred, so combinations sharing a worker take turns instead of one starving the others
+            pool.submit([&, instance, method, group, nextFirstRun]() { runChunk(instance, method, group, nextFirstRun, runsPerTask); }, true);
+            return;
+        }
+        if (!finished)
+            return;
+
+        group->outcome.result.masterSeed = baseOptions.masterSeed;
+        group->outcome.result.threads = threads;
+        std::lock_guard<std::mutex> lock(streamMutex);
+        onResult(group->outcome);
+    };
+
+    for (const auto& instanceName : spec.instances) {
+        // Reading the instance is itself a task; it fans out into the method chunks once the matrix is built
+        pool.submit([&, instanceName]() {
+            std::vector<std::vector<int>> data;
+            FileReader reader(instanceName);
+            if (!reader.getDataFromFile(data)) {
+                std::lock_guard<std::mutex> lock(streamMutex);
+                std::cerr << "Failed to read data from file: " << instanceName << std::endl;
+                return;
+            }
+            std::shared_ptr<const DataManager> instance = std::make_shared<const DataManager>(data);
+
+            for (const auto& methodName : spec.methods) {
+                MethodIt method = methods.find(methodName);
+                if (method == methods.end()) {
+                    std::lock_guard<std::mutex> lock(streamMutex);
+                    std::cerr << "Unknown method: " << methodName << std::endl;
+                    continue;
+                }
+
+                for (const auto& params : spec.parameterSets) {
+                    auto group = std::make_shared<Group>();
+                    group->outcome.instance = instanceName;
+                    group->outcome.method = methodName;
+                    group->outcome.params = params;
+                    group->incumbent = std::make_unique<Incumbent>(baseOptions.targetObjective);
+
+                    if (unbounded) {
+                        // One self-renewing chunk per worker keeps every core busy until the deadline
+                        group->activeChunks = threads;
+                        group->nextFirstRun = threads * runsPerTask;
+                        for (int c = 0; c < threads; c++)
+                            pool.submit([&, instance, method, group, c]() { runChunk(instance, method, group, c * runsPerTask, runsPerTask); });
+                        continue;
+                    }
+
+                    group->activeChunks = (spec.runs + runsPerTask - 1) / runsPerTask;
+                    for (int firstRun = 0; firstRun < spec.runs; firstRun += runsPerTask) {
+                        int chunkRuns = std::min(runsPerTask, spec.runs - firstRun);
+                        pool.submit([&, instance, method, group, firstRun, chunkRuns]() { runChunk(instance, method, group, firstRun, chunkRuns); });
+                    }
+                }
+            }
+        });
+    }
+
+    pool.wait();
+}
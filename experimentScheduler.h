@@ -0,0 +1,94 @@
+#ifndef EXPERIMENT_SCHEDULER_H
+#define EXPERIMENT_SCHEDULER_H
+
+#include <vector>
+#include <deque>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <functional>
+#include <condition_variable>
+
+#include "dataManager.h"
+#include "multiStartRunner.h"
+
+/**
+ * @brief Thread pool with one task deque per worker.
+ * A worker pops from the back of its own deque and, when that is empty,
+ * steals from the front of the others, so a long task never keeps short
+ * ones waiting behind it. Tasks may submit further tasks.
+ */
+class WorkStealingPool {
+public:
+    explicit WorkStealingPool(int threads);
+    ~WorkStealingPool();
+
+    // A deferred task goes to the far end of the deque, so its owner runs everything else queued there first
+    void submit(std::function<void()> task, bool deferred = false);
+    void wait();
+
+private:
+    struct Queue {
+        std::deque<std::function<void()>> tasks;
+        std::mutex mutex;
+    };
+
+    bool popLocal(int workerId, std::function<void()>& task);
+    bool steal(int workerId, std::function<void()>& task);
+    void workerLoop(int workerId);
+
+    std::vector<std::unique_ptr<Queue>> queues;
+    std::vector<std::thread> workers;
+    std::atomic<int> pending;
+    std::atomic<unsigned> nextQueue;
+    int queued;    // tasks pushed but not yet claimed, guarded by idleMutex
+    bool stopping;
+    std::mutex idleMutex;
+    std::condition_variable idleCondition;
+    std::condition_variable doneCondition;
+};
+
+using ExperimentParams = std::map<std::string, double>;
+
+/**
+ * @brief Instances x methods x parameter sets, each repeated `runs` times.
+ * The runs of one combination are cut into chunks of runsPerTask, so slow
+ * methods are spread over all workers instead of pinning one of them.
+ */
+struct ExperimentSpec {
+    std::vector<std::string> instances;
+    std::vector<std::string> methods;
+    std::vector<ExperimentParams> parameterSets = {ExperimentParams()};
+    int runs = 200;                // with a time limit an upper bound; <= 0 runs until the deadline
+    int runsPerTask = 10;
+    int threads = 0; // 0 = EC_THREADS / all cores
+    double timeLimitSeconds = 0.0; // wall clock for the whole experiment, 0 = unlimited
+    bool hardwareCounters = false;  // wrap every chunk in a PerfCounterGroup (Linux, when permitted); scans run single-threaded
+};
+
+struct ExperimentOutcome {
+    std::string instance;
+    std::string method;
+    ExperimentParams params;
+    MultiStartResult result; // elapsedSeconds sums the CPU time of all chunks, runs counts only executed runs
+};
+
+// A method runs `options.firstRun ..` runs single-threaded on read-only instance data
+using ExperimentMethod = std::function<MultiStartResult(const DataManager& instance, const ExperimentParams& params,
+                                                        int runs, const MultiStartOptions& options)>;
+
+/**
+ * @brief Expands the spec into tasks and runs them on a WorkStealingPool.
+ * Each instance is read once and shared by all of its tasks. onResult is
+ * called (serialized) as soon as every chunk of a combination finished, so
+ * results stream out in completion order rather than spec order.
+ * With a time limit, chunks not started before the deadline are dropped and
+ * running chunks stop their searches at the deadline (see runMultiStart).
+ */
+void runExperiment(const ExperimentSpec& spec, const std::map<std::string, ExperimentMethod>& methods,
+                   const std::function<void(const ExperimentOutcome&)>& onResult);
+
+#endif
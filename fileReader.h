@@ -1,3 +1,6 @@
+#ifndef FILE_READER_H
+#define FILE_READER_H
+
 #include <iostream>
 #include <fstream>
 #include <string>
@@ -25,4 +28,6 @@ public:
 
 private:
     std::string filename;
-};
\ No newline at end of file
+};
+
+#endif
@@ -0,0 +1,160 @@
+#include <vector>
+#include <memory>
+#include <random>
+#include <algorithm>
+
+#include "hybridEvolutionary.h"
+#include "regretInsertion.h"
+#include "solutionPool.h"
+#include "tourHash.h"
+#include "experimentScheduler.h"
+#include "localSearch.h"
+#include "tourUtils.h"
+#include "deadline.h"
+#include "incumbent.h"
+
+namespace {
+    // Position index of a tour: pos[node] = index in solution, or -1 if not in solution
+    std::vector<int> positions(const std::vector<int> &solution, int size) {
+        std::vector<int> pos(size, -1);
+        for (int i = 0; i < static_cast<int>(solution.size()); ++i)
+            pos[solution[i]] = i;
+        return pos;
+    }
+
+    bool adjacentIn(const std::vector<int> &pos, int n, int u, int v) {
+        int pu = pos[u], pv = pos[v];
+        if (pu == -1 || pv == -1) return false;
+        int gap = std::abs(pu - pv);
+        return gap == 1 || gap == n - 1;
+    }
+
+    /**
+     * The nodes of base that other (given by its position index) selects too,
+     * in base order, so every common edge stays adjacent. With commonEdgesOnly,
+     * a common node is only kept if one of its base edges is common; that
+     * leaves the repair more to rebuild.
+     */
+    std::vector<int> recombine(const std::vector<int> &base, const std::vector<int> &otherPos, int otherLength, bool commonEdgesOnly) {
+        int n = static_cast<int>(base.size());
+        std::vector<int> child;
+        child.reserve(n);
+        for (int i = 0; i < n; ++i) {
+            int v = base[i];
+            if (otherPos[v] == -1) continue;
+            if (commonEdgesOnly && !adjacentIn(otherPos, otherLength, base[(i - 1 + n) % n], v) &&
+                !adjacentIn(otherPos, otherLength, v, base[(i + 1) % n]))
+                continue;
+            child.push_back(v);
+        }
+        return child;
+    }
+
+    // Runs fn(0..count-1) on the pool, or inline without one; each task gets the caller's deadline and its own counters
+    template <typename Fn>
+    void forEachTask(WorkStealingPool *pool, int count, std::vector<SearchCounters> &counters, Fn fn) {
+        counters.assign(count, SearchCounters());
+        if (!pool) {
+            for (int i = 0; i < count; ++i) fn(i);
+            return;
+        }
+        Deadline deadline = Deadline::current();
+        for (int i = 0; i < count; ++i) {
+            pool->submit([&, deadline, i]() {
+                Deadline::current() = deadline;
+                if (searchCountersEnabled) runCounters() = SearchCounters();
+                fn(i);
+                if (searchCountersEnabled) counters[i] = runCounters();
+                Deadline::current() = Deadline();
+            });
+        }
+        pool->wait();
+        if (searchCountersEnabled)
+            for (const SearchCounters &c : counters) runCounters().add(c);
+    }
+}
+
+MultiStartResult hybridEvolutionary(int **distanceMatrix, const std::vector<int> &costVector, int size,
+                                    const HeaParams &params, int totalRuns, const MultiStartOptions &options)
+{
+    if (size <= 0) return MultiStartResult();
+
+    int nodesToVisit = getNodesToVisit(size);
+    int populationSize = std::max(2, params.population);
+    int batch = std::max(1, params.batch);
+    int workers = std::max(1, params.workers);
+    std::vector<std::vector<int>> candidateList = createCandidateList(distanceMatrix, costVector, size, params.K);
+
+    auto improve = [&](std::vector<int> &solution, int cost) {
+        return params.localSearch ? runCandidateListSearch(distanceMatrix, costVector, candidateList, size, solution, cost) : cost;
+    };
+
+    MultiStartOptions runOptions = options;
+    runOptions.threads = std::max(1, options.threads / workers);
+
+    return runMultiStart(totalRuns, [&](int, RunRng &g) -> RunResult {
+        std::unique_ptr<WorkStealingPool> pool;
+        if (workers > 1) pool = std::make_unique<WorkStealingPool>(workers);
+        uint64_t streamHigh = g();
+        uint64_t streamLow = g();
+        uint64_t streamSeed = (streamHigh << 32) | streamLow;
+        uint64_t nextStream = 0;
+        Deadline &deadline = Deadline::current();
+        std::vector<SearchCounters> taskCounters;
+
+        // Initial population: local optima of random tours, duplicates drawn again
+        ElitePool population(populationSize);
+        for (int attempt = 0; !population.full() && attempt < 10; ++attempt) {
+            int missing = populationSize - population.size();
+            std::vector<EliteEntry> candidates(missing);
+            uint64_t firstStream = nextStream;
+            nextStream += missing;
+            forEachTask(pool.get(), missing, taskCounters, [&](int i) {
+                RunRng rng(streamSeed, firstStream + i);
+                std::vector<int> solution = randomPermutation(size, rng);
+                int cost = improve(solution, evaluateSolution(solution, distanceMatrix, costVector));
+                candidates[i] = {cost, TourHash::of(solution).value, std::move(solution)};
+            });
+            for (const EliteEntry &candidate : candidates)
+                if (!population.full())
+                    population.offer(candidate.cost, candidate.hash, candidate.solution);
+            if (deadline.expired(static_cast<long>(missing) * size)) break;
+        }
+
+        std::vector<EliteEntry> offspring(batch);
+        for (int produced = 0; produced < params.offspring && population.size() >= 2; produced += batch) {
+            if (deadline.expired(static_cast<long>(batch) * size)) break;
+            EC_COUNT(iterations, 1);
+
+            uint64_t firstStream = nextStream;
+            nextStream += batch;
+            forEachTask(pool.get(), batch, taskCounters, [&](int i) {
+                RunRng rng(streamSeed, firstStream + i);
+                std::uniform_int_distribution<int> parentDist(0, population.size() - 1);
+                int p1 = parentDist(rng), p2 = parentDist(rng);
+                while (p2 == p1) p2 = parentDist(rng);
+
+                const std::vector<int> &base = population[p1].solution, &other = population[p2].solution;
+                RegretInsertionTour tour(distanceMatrix, costVector, size);
+                std::vector<int> child = recombine(base, positions(other, size), static_cast<int>(other.size()), rng() & 1);
+                if (child.empty())
+                    tour.start(base[0]);
+                else
+                    tour.assign(child, evaluateSolution(child, distanceMatrix, costVector));
+                tour.repair(nodesToVisit, params.alpha);
+
+                std::vector<int> solution = tour.toSolution();
+                int cost = improve(solution, tour.cost);
+                offspring[i] = {cost, TourHash::of(solution).value, std::move(solution)};
+            });
+
+            // Steady state: an offspring replaces the worst member if it is better and new
+            for (const EliteEntry &child : offspring)
+                population.offer(child.cost, child.hash, child.solution);
+            Incumbent::publish(population.best().cost, population.best().solution);
+        }
+
+        const EliteEntry &best = population.best();
+        return {best.cost, best.solution};
+    }, runOptions);
+}
@@ -0,0 +1,39 @@
+#ifndef HYBRID_EVOLUTIONARY_H
+#define HYBRID_EVOLUTIONARY_H
+
+#include <vector>
+
+#include "multiStartRunner.h"
+
+struct HeaParams {
+    int population = 20;      // elite size, filled with distinct local optima of random tours
+    int offspring = 2000;     // offspring per run (the time budget may end a run earlier)
+    int batch = 4;            // offspring recombined from the same population before they are inserted
+    int workers = 1;          // threads evaluating the offspring of a batch
+    double alpha = 0.5;       // repair score, as in greedyWeightedRegret
+    bool localSearch = true;  // candidate-list steepest search on every offspring
+    int K = 10;               // candidate list size of that search
+};
+
+/**
+ * @brief Steady-state hybrid evolutionary algorithm.
+ * An offspring keeps the nodes of one parent that the other parent selects
+ * too, in the first parent's order, so every common edge and every common
+ * node survives (a random half of the offspring keeps only the common nodes on a
+ * common edge); the recombination is a single O(n) pass over the tour with
+ * the other parent's position array. The rest of the tour is rebuilt by
+ * weighted 2-regret insertion (RegretInsertionTour) and improved by the
+ * candidate-list steepest search.
+ *
+ * The offspring of a batch are drawn from the same population, evaluated by
+ * `workers` threads and offered to the population (an ElitePool) in batch
+ * order: one replaces the worst member if it is better and its TourHash is
+ * not pooled yet. Every offspring
+ * draws from its own stream, so the results do not depend on `workers`.
+ * The runs of a multi-start share options.threads with the workers.
+ */
+MultiStartResult hybridEvolutionary(int **distanceMatrix, const std::vector<int> &costVector, int size,
+                                    const HeaParams &params = HeaParams(), int totalRuns = 20,
+                                    const MultiStartOptions &options = MultiStartOptions::fromEnvironment());
+
+#endif
@@ -0,0 +1,68 @@
+#include <thread>
+#include <algorithm>
+
+#include "incumbent.h"
+
+Incumbent::Incumbent(int targetObjective)
+    : target(targetObjective), best(std::numeric_limits<int>::max()), stop(false), sequence(0), length(0),
+      nodes(nullptr), capacity(0) {}
+
+bool Incumbent::offer(int objective, const std::vector<int> &solution) {
+    if (solution.empty() || objective >= best.load(std::memory_order_relaxed)) return false;
+
+    // Claim the writer side; the incumbent may improve past this tour while another writer holds it
+    uint64_t seen = sequence.load(std::memory_order_relaxed);
+    for (;;) {
+        if (objective >= best.load(std::memory_order_relaxed)) return false;
+        if (seen & 1) {
+            std::this_thread::yield();
+            seen = sequence.load(std::memory_order_relaxed);
+        } else if (sequence.compare_exchange_weak(seen, seen + 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+            break;
+        }
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+
+    bool taken = objective < best.load(std::memory_order_relaxed);
+    if (taken) {
+        int n = static_cast<int>(solution.size());
+        if (n > capacity) {
+            capacity = std::max(n, 2 * capacity);
+            buffers.emplace_back(new std::atomic<int32_t>[capacity]);
+            nodes.store(buffers.back().get(), std::memory_order_relaxed);
+        }
+        std::atomic<int32_t> *buffer = nodes.load(std::memory_order_relaxed);
+        for (int i = 0; i < n; ++i)
+            buffer[i].store(solution[i], std::memory_order_relaxed);
+        // A reader that sees the new length also sees the buffer that holds it
+        length.store(n, std::memory_order_release);
+        best.store(objective, std::memory_order_release);
+    }
+    sequence.store(seen + 2, std::memory_order_release);
+
+    if (taken && hasTarget() && objective <= target) stop.store(true, std::memory_order_release);
+    return taken;
+}
+
+bool Incumbent::snapshot(int &objective, std::vector<int> &solution) const {
+    for (;;) {
+        uint64_t before = sequence.load(std::memory_order_acquire);
+        if (before & 1) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        int n = length.load(std::memory_order_acquire);
+        if (n == 0) return false;
+        const std::atomic<int32_t> *buffer = nodes.load(std::memory_order_relaxed);
+        int value = best.load(std::memory_order_relaxed);
+        solution.resize(n);
+        for (int i = 0; i < n; ++i)
+            solution[i] = buffer[i].load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (sequence.load(std::memory_order_relaxed) != before) continue; // rewritten while copying
+        objective = value;
+        return true;
+    }
+}
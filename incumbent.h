@@ -0,0 +1,76 @@
+#ifndef INCUMBENT_H
+#define INCUMBENT_H
+
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <vector>
+#include <cstdint>
+
+/**
+ * @brief Best tour found so far by all threads of a multi-start run (or of
+ * all chunks of an experiment combination).
+ *
+ * The objective is a plain atomic, so a search reads it with one load. The
+ * tour sits behind a seqlock: a writer moves the sequence from even to odd,
+ * stores the nodes as relaxed atomics and moves it to the next even value; a
+ * reader keeps its copy only if it saw the same even sequence before and
+ * after it, so readers never block writers. Writers exclude each other
+ * through the odd sequence, and an offer that is not better than the
+ * objective returns after one load. A tour longer than the buffer gets a new
+ * buffer; old buffers live until the incumbent does, so a reader racing the
+ * swap reads valid memory and then fails its sequence check.
+ *
+ * With a target objective, the first tour at or below it raises the stop
+ * flag, which runMultiStart installs in Deadline: every search stops at its
+ * next deadline check and no further runs start.
+ */
+class Incumbent {
+public:
+    static constexpr int noTarget = std::numeric_limits<int>::min();
+
+    explicit Incumbent(int targetObjective = noTarget);
+    Incumbent(const Incumbent &) = delete;
+    Incumbent &operator=(const Incumbent &) = delete;
+
+    // Takes the tour if it is strictly better than the incumbent; returns whether it did
+    bool offer(int objective, const std::vector<int> &solution);
+    // Copies the incumbent; false while there is none
+    bool snapshot(int &objective, std::vector<int> &solution) const;
+
+    int objective() const { return best.load(std::memory_order_acquire); }
+    bool hasTarget() const { return target != noTarget; }
+    bool targetReached() const { return stop.load(std::memory_order_acquire); }
+    // The flag Deadline polls, nullptr without a target
+    const std::atomic<bool> *stopFlag() const { return hasTarget() ? &stop : nullptr; }
+
+    // Incumbent of the run on this thread, installed by runMultiStart; nullptr outside of runs
+    static Incumbent *&current() {
+        thread_local Incumbent *incumbent = nullptr;
+        return incumbent;
+    }
+
+    // Offers to current(), if any; searches call it whenever their own best improves
+    static void publish(int objective, const std::vector<int> &solution) {
+        if (Incumbent *incumbent = current()) incumbent->offer(objective, solution);
+    }
+    // Whether publish() would take a tour of this objective, for searches that first have to build the tour
+    static bool improves(int objective) {
+        Incumbent *incumbent = current();
+        return incumbent && objective < incumbent->objective();
+    }
+
+private:
+    int target;
+    std::atomic<int> best;
+    std::atomic<bool> stop;
+    std::atomic<uint64_t> sequence;
+    std::atomic<int32_t> length;
+    std::atomic<std::atomic<int32_t> *> nodes;
+
+    // Only touched by the writer holding the odd sequence
+    int capacity;
+    std::vector<std::unique_ptr<std::atomic<int32_t>[]>> buffers;
+};
+
+#endif
@@ -0,0 +1,48 @@
+#include "instanceCache.h"
+#include "constructionCache.h"
+
+InstanceCache& InstanceCache::shared() {
+    static InstanceCache cache;
+    return cache;
+}
+
+std::shared_ptr<InstanceCache::Entry> InstanceCache::entry(int **distanceMatrix, const std::vector<int>& costVector, int size) {
+    Key key(distanceMatrix, costVector.data(), static_cast<size_t>(size));
+    std::lock_guard<std::mutex> lock(this->mutex);
+    std::shared_ptr<Entry>& slot = this->entries[key];
+    if (!slot) slot = std::make_shared<Entry>();
+    return slot;
+}
+
+uint64_t InstanceCache::hash(int **distanceMatrix, const std::vector<int>& costVector, int size) {
+    std::shared_ptr<Entry> e = entry(distanceMatrix, costVector, size);
+    std::call_once(e->hashBuilt, [&]() { e->hash = ConstructionCache::hashInstance(distanceMatrix, costVector, size); });
+    return e->hash;
+}
+
+std::shared_ptr<const NeighbourLists> InstanceCache::neighbourLists(int **distanceMatrix, const std::vector<int>& costVector, int size) {
+    std::shared_ptr<Entry> e = entry(distanceMatrix, costVector, size);
+    std::call_once(e->listsBuilt, [&]() { e->lists = std::make_shared<const NeighbourLists>(distanceMatrix, size); });
+    return e->lists;
+}
+
+std::shared_ptr<const ExchangeOrder> InstanceCache::exchangeOrder(int **distanceMatrix, const std::vector<int>& costVector, int size) {
+    std::shared_ptr<Entry> e = entry(distanceMatrix, costVector, size);
+    std::call_once(e->orderBuilt, [&]() { e->order = std::make_shared<const ExchangeOrder>(distanceMatrix, costVector, size); });
+    return e->order;
+}
+
+void InstanceCache::forget(int **distanceMatrix) {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    for (auto it = this->entries.begin(); it != this->entries.end();) {
+        if (std::get<0>(it->first) == distanceMatrix)
+            it = this->entries.erase(it);
+        else
+            ++it;
+    }
+}
+
+void InstanceCache::clear() {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->entries.clear();
+}
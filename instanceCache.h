@@ -0,0 +1,52 @@
+#ifndef INSTANCE_CACHE_H
+#define INSTANCE_CACHE_H
+
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <memory>
+#include <vector>
+#include <cstdint>
+
+#include "neighbourLists.h"
+#include "exchangeOrder.h"
+
+/**
+ * @brief What the searches derive from an instance alone: its hash
+ * (ConstructionCache::hashInstance), the full NeighbourLists and the
+ * ExchangeOrder. Each is built by the first invocation that needs it and
+ * shared by all later ones, so a scheduler chunk or a daemon solve does not
+ * pay O(size^2) and more for them again. Entries are keyed like
+ * CandidateListCache by the addresses and size of the distance matrix and cost
+ * vector; DataManager forgets its own when it is destroyed or changed in place,
+ * so a freed address is never matched by another instance.
+ */
+class InstanceCache {
+public:
+    static InstanceCache& shared();
+
+    uint64_t hash(int **distanceMatrix, const std::vector<int>& costVector, int size);
+    std::shared_ptr<const NeighbourLists> neighbourLists(int **distanceMatrix, const std::vector<int>& costVector, int size);
+    std::shared_ptr<const ExchangeOrder> exchangeOrder(int **distanceMatrix, const std::vector<int>& costVector, int size);
+
+    // Drops everything derived from the instance with this distance matrix
+    void forget(int **distanceMatrix);
+    void clear();
+
+private:
+    // Built once, outside the map lock, by whichever thread asks first
+    struct Entry {
+        std::once_flag hashBuilt, listsBuilt, orderBuilt;
+        uint64_t hash = 0;
+        std::shared_ptr<const NeighbourLists> lists;
+        std::shared_ptr<const ExchangeOrder> order;
+    };
+    using Key = std::tuple<int **, const int *, size_t>;
+
+    std::shared_ptr<Entry> entry(int **distanceMatrix, const std::vector<int>& costVector, int size);
+
+    std::map<Key, std::shared_ptr<Entry>> entries;
+    std::mutex mutex;
+};
+
+#endif
@@ -0,0 +1,116 @@
+#include <vector>
+#include <memory>
+#include <thread>
+#include <string>
+#include <limits>
+#include <cstdlib>
+#include <algorithm>
+
+#include "islandModel.h"
+#include "migrationRing.h"
+#include "instanceCache.h"
+#include "tourUtils.h"
+#include "deadline.h"
+#include "incumbent.h"
+
+namespace {
+    // Tours from another process are only trusted after this check
+    bool isValidTour(const std::vector<int> &solution, int size, int nodesToVisit, std::vector<char> &seen) {
+        if (static_cast<int>(solution.size()) != nodesToVisit) return false;
+        std::fill(seen.begin(), seen.end(), 0);
+        for (int v : solution) {
+            if (v < 0 || v >= size || seen[v]) return false;
+            seen[v] = 1;
+        }
+        return true;
+    }
+}
+
+MultiStartResult islandModel(int **distanceMatrix, const std::vector<int> &costVector, int size,
+                             const IslandParams &params, int totalRuns, const MultiStartOptions &options)
+{
+    if (size <= 0) return MultiStartResult();
+
+    int hardware = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    int islands = params.islands > 0 ? params.islands : std::min(options.threads, hardware);
+    islands = std::max(1, islands);
+    int interval = std::max(1, params.migrationInterval);
+    int nodesToVisit = getNodesToVisit(size);
+    const char *shmName = std::getenv("EC_ISLAND_SHM");
+    uint64_t instanceHash = shmName ? InstanceCache::shared().hash(distanceMatrix, costVector, size) : 0;
+
+    MultiStartOptions runOptions = options;
+    runOptions.threads = std::max(1, options.threads / islands);
+
+    return runMultiStart(totalRuns, [&](int run, RunRng &g) -> RunResult {
+        int slots = std::max(16, 4 * islands);
+        std::unique_ptr<MigrationRing> ring = shmName
+            ? std::make_unique<MigrationRing>(std::string(shmName) + "-" + std::to_string(run), instanceHash, slots, nodesToVisit)
+            : std::make_unique<MigrationRing>(slots, nodesToVisit);
+
+        uint64_t streamHigh = g();
+        uint64_t streamLow = g();
+        uint64_t streamSeed = (streamHigh << 32) | streamLow;
+        Deadline deadline = Deadline::current();
+        Incumbent *incumbent = Incumbent::current();
+        std::vector<RunResult> islandBest(islands);
+        std::vector<SearchCounters> islandCounters(islands);
+
+        auto island = [&](int id) {
+            Deadline::current() = deadline;
+            Incumbent::current() = incumbent;
+            if (searchCountersEnabled) runCounters() = SearchCounters();
+            RunRng rng(streamSeed, static_cast<uint64_t>(id));
+            IlsChain chain(distanceMatrix, costVector, size, params.ils);
+            uint64_t cursor = ring->head();
+            chain.start(rng);
+
+            int publishedCost = std::numeric_limits<int>::max();
+            std::vector<MigrationRing::Migrant> migrants;
+            std::vector<char> seen(size);
+            Deadline &islandDeadline = Deadline::current();
+            for (int iteration = 1; iteration <= params.iterations && !islandDeadline.expired(chain.stepWork()); ++iteration) {
+                chain.step(rng);
+                if (iteration % interval != 0) continue;
+
+                if (chain.bestCost() < publishedCost && ring->publish(chain.bestCost(), chain.bestSolution()))
+                    publishedCost = chain.bestCost();
+
+                migrants.clear();
+                ring->collect(cursor, migrants);
+                const MigrationRing::Migrant *bestMigrant = nullptr;
+                for (const auto &migrant : migrants)
+                    if (migrant.cost < chain.bestCost() && (!bestMigrant || migrant.cost < bestMigrant->cost))
+                        bestMigrant = &migrant;
+                if (bestMigrant && isValidTour(bestMigrant->solution, size, nodesToVisit, seen)) {
+                    chain.adopt(bestMigrant->solution);
+                    publishedCost = std::min(publishedCost, bestMigrant->cost); // no need to send it back
+                }
+            }
+
+            islandBest[id] = {chain.bestCost(), chain.bestSolution()};
+            if (searchCountersEnabled) islandCounters[id] = runCounters();
+            Deadline::current() = Deadline();
+            Incumbent::current() = nullptr;
+        };
+
+        std::vector<std::thread> threads;
+        for (int id = 1; id < islands; ++id) threads.emplace_back(island, id);
+        SearchCounters own = runCounters();
+        island(0);
+        for (auto &thread : threads) thread.join();
+        Deadline::current() = deadline;
+        Incumbent::current() = incumbent;
+
+        if (searchCountersEnabled) {
+            runCounters() = own;
+            for (const SearchCounters &c : islandCounters) runCounters().add(c);
+        }
+
+        // Lowest island id wins ties, like the lowest run id of a multi-start
+        int bestIsland = 0;
+        for (int id = 1; id < islands; ++id)
+            if (islandBest[id].objective < islandBest[bestIsland].objective) bestIsland = id;
+        return islandBest[bestIsland];
+    }, runOptions);
+}
@@ -0,0 +1,33 @@
+#ifndef ISLAND_MODEL_H
+#define ISLAND_MODEL_H
+
+#include <vector>
+
+#include "multiStartRunner.h"
+#include "iteratedLocalSearch.h"
+
+struct IslandParams {
+    int islands = 0;             // ILS chains, one thread each; 0 = options.threads, at most one per core
+    int iterations = 1000;       // ILS iterations per island (the time budget may end a run earlier)
+    int migrationInterval = 50;  // iterations between two migrations of an island
+    IlsParams ils;               // iterations inside are ignored
+};
+
+/**
+ * @brief Island model of ILS chains (iteratedLocalSearch.h).
+ * Every island runs its own chain on its own thread and every
+ * migrationInterval iterations publishes its best tour to a MigrationRing
+ * (if it improved since the last migration) and continues from the best
+ * immigrant that beats its own best. Islands never wait for each other.
+ *
+ * With EC_ISLAND_SHM=/name in the environment the ring of run r is the POSIX
+ * shared memory segment "/name-r", so solver processes started with the same
+ * name (and different seeds) on one machine exchange tours as well.
+ * Migration timing depends on thread scheduling, so only a single island is
+ * reproducible from the seed.
+ */
+MultiStartResult islandModel(int **distanceMatrix, const std::vector<int> &costVector, int size,
+                             const IslandParams &params = IslandParams(), int totalRuns = 1,
+                             const MultiStartOptions &options = MultiStartOptions::fromEnvironment());
+
+#endif
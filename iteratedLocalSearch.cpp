@@ -0,0 +1,128 @@
+#include <vector>
+#include <random>
+#include <algorithm>
+
+#include "iteratedLocalSearch.h"
+#include "tourUtils.h"
+#include "deadline.h"
+#include "incumbent.h"
+#include "instanceCache.h"
+
+namespace {
+    void rebuildPositions(const std::vector<int> &solution, std::vector<int> &pos) {
+        std::fill(pos.begin(), pos.end(), -1);
+        for (int i = 0; i < static_cast<int>(solution.size()); ++i)
+            pos[solution[i]] = i;
+    }
+
+    // A B C D -> A C B D with three random cuts; returns the endpoints of the three new edges
+    void doubleBridge(std::vector<int> &sol, std::vector<int> &pos, RunRng &g, std::vector<int> &changed) {
+        int n = static_cast<int>(sol.size());
+        if (n < 8) return;
+
+        std::uniform_int_distribution<int> cutDist(1, n - 1);
+        int cuts[3];
+        do {
+            for (int &c : cuts) c = cutDist(g);
+            std::sort(cuts, cuts + 3);
+        } while (cuts[0] == cuts[1] || cuts[1] == cuts[2]);
+        int p1 = cuts[0], p2 = cuts[1], p3 = cuts[2];
+
+        std::vector<int> reordered;
+        reordered.reserve(n);
+        reordered.insert(reordered.end(), sol.begin(), sol.begin() + p1);
+        reordered.insert(reordered.end(), sol.begin() + p2, sol.begin() + p3);
+        reordered.insert(reordered.end(), sol.begin() + p1, sol.begin() + p2);
+        reordered.insert(reordered.end(), sol.begin() + p3, sol.end());
+
+        for (int p : {p1 - 1, p1, p2 - 1, p2, p3 - 1, p3 % n})
+            changed.push_back(sol[p]);
+        sol.swap(reordered);
+        rebuildPositions(sol, pos);
+    }
+
+    // Replaces a random selected node by a random unselected one
+    void randomExchange(std::vector<int> &sol, std::vector<int> &pos, int size, RunRng &g, std::vector<int> &changed) {
+        int n = static_cast<int>(sol.size());
+        if (n == size || n < 3) return;
+
+        std::uniform_int_distribution<int> posDist(0, n - 1);
+        std::uniform_int_distribution<int> nodeDist(0, size - 1);
+        int i = posDist(g);
+        int v = nodeDist(g);
+        while (pos[v] != -1) v = nodeDist(g);
+
+        int u = sol[i];
+        changed.insert(changed.end(), {u, v, sol[(i - 1 + n) % n], sol[(i + 1) % n]});
+        sol[i] = v;
+        pos[u] = -1;
+        pos[v] = i;
+    }
+}
+
+IlsChain::IlsChain(int **distanceMatrix, const std::vector<int> &costVector, int size, const IlsParams &params)
+    : distanceMatrix(distanceMatrix), costVector(costVector), size(size), params(params),
+      exchangeOrder(InstanceCache::shared().exchangeOrder(distanceMatrix, costVector, size)) {}
+
+void IlsChain::searchFromScratch() {
+    current.pos.assign(size, -1);
+    rebuildPositions(current.solution, current.pos);
+    current.LM.clear();
+    generateMoves(distanceMatrix, costVector, current.solution, current.pos, current.LM, true, size, {}, params.orOpt, nullptr, exchangeOrder.get());
+    std::sort(current.LM.begin(), current.LM.end(), compareMoves);
+    runMoveListSearch(distanceMatrix, costVector, size, current.solution, current.pos, current.LM, params.orOpt, exchangeOrder.get());
+    current.cost = evaluateSolution(current.solution, distanceMatrix, costVector);
+}
+
+void IlsChain::start(RunRng &g) {
+    current.solution = randomPermutation(size, g);
+    searchFromScratch();
+    best = current;
+    Incumbent::publish(best.cost, best.solution);
+}
+
+void IlsChain::adopt(const std::vector<int> &solution) {
+    current.solution = solution;
+    searchFromScratch();
+    if (current.cost < best.cost)
+        best = current;
+}
+
+void IlsChain::step(RunRng &g) {
+    EC_COUNT(iterations, 1);
+    changed.clear();
+    if (params.doubleBridge)
+        doubleBridge(current.solution, current.pos, g, changed);
+    for (int e = 0; e < params.exchanges; ++e)
+        randomExchange(current.solution, current.pos, size, g, changed);
+
+    std::sort(changed.begin(), changed.end());
+    changed.erase(std::unique(changed.begin(), changed.end()), changed.end());
+    addMovesAround(distanceMatrix, costVector, current.solution, current.pos, current.LM, size, changed, params.orOpt, exchangeOrder.get());
+    runMoveListSearch(distanceMatrix, costVector, size, current.solution, current.pos, current.LM, params.orOpt, exchangeOrder.get());
+    current.cost = evaluateSolution(current.solution, distanceMatrix, costVector);
+
+    if (current.cost < best.cost) {
+        best = current;
+        Incumbent::publish(best.cost, best.solution);
+    } else {
+        current = best;
+    }
+}
+
+MultiStartResult iteratedLocalSearch(int **distanceMatrix, const std::vector<int> &costVector, int size,
+                                     const IlsParams &params, int totalRuns, const MultiStartOptions &options)
+{
+    if (size <= 0) return MultiStartResult();
+
+    return runMultiStart(totalRuns, [&](int, RunRng &g) -> RunResult {
+        IlsChain chain(distanceMatrix, costVector, size, params);
+        chain.start(g);
+
+        Deadline &deadline = Deadline::current();
+        for (int iteration = 0; iteration < params.iterations && !deadline.expired(chain.stepWork()); ++iteration)
+            chain.step(g);
+
+        return {chain.bestCost(), chain.bestSolution()};
+    }, options);
+}
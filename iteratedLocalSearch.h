@@ -0,0 +1,69 @@
+#ifndef ITERATED_LOCAL_SEARCH_H
+#define ITERATED_LOCAL_SEARCH_H
+
+#include <vector>
+#include <memory>
+
+#include "multiStartRunner.h"
+#include "localSearch.h"
+
+struct IlsParams {
+    int iterations = 1000;   // perturbation + re-optimization rounds per run (the time budget may end a run earlier)
+    bool doubleBridge = true; // reconnect three tour segments in another order
+    int exchanges = 2;        // random selected/unselected node exchanges per perturbation
+    bool orOpt = false;       // add Or-opt segment relocation to the local search
+};
+
+/**
+ * @brief One ILS trajectory, advanced an iteration at a time so callers
+ * (iteratedLocalSearch, the island model) can interleave their own work.
+ */
+class IlsChain {
+public:
+    IlsChain(int **distanceMatrix, const std::vector<int> &costVector, int size, const IlsParams &params);
+
+    // Local optimum of a random tour; the only full move scan unless adopt() is called
+    void start(RunRng &g);
+    // One perturbation and re-optimization; keeps the better of it and the best state
+    void step(RunRng &g);
+    // Continues from the given tour (e.g. an immigrant) after a full move scan and search
+    void adopt(const std::vector<int> &solution);
+
+    int bestCost() const { return best.cost; }
+    const std::vector<int> &bestSolution() const { return best.solution; }
+    // Work of the next step(), in the units of Deadline::expired
+    long stepWork() const { return static_cast<long>(current.solution.size() + current.LM.size()); }
+
+private:
+    struct SearchState {
+        std::vector<int> solution;
+        std::vector<int> pos; // pos[node] = index in solution, or -1 if not in solution
+        std::vector<Move> LM;
+        int cost = 0;
+    };
+
+    void searchFromScratch();
+
+    int **distanceMatrix;
+    const std::vector<int> &costVector;
+    int size;
+    IlsParams params;
+    std::shared_ptr<const ExchangeOrder> exchangeOrder; // shared with every chain on the instance (InstanceCache)
+    SearchState current, best;
+    std::vector<int> changed;
+};
+
+/**
+ * @brief Iterated local search on top of the move-list steepest search (Assignment 5).
+ * The tour, its position index and the sorted move list survive from one
+ * iteration to the next: a perturbation only adds the moves around the
+ * nodes whose edges it changed, moves it broke are dropped lazily by
+ * checkEdge, and the search continues from that partial state instead of a
+ * full generateMoves rescan. A worse local optimum is discarded by restoring
+ * the best state (tour, positions and move list).
+ */
+MultiStartResult iteratedLocalSearch(int **distanceMatrix, const std::vector<int> &costVector, int size,
+                                     const IlsParams &params = IlsParams(), int totalRuns = 20,
+                                     const MultiStartOptions &options = MultiStartOptions::fromEnvironment());
+
+#endif
@@ -0,0 +1,130 @@
+#include <vector>
+#include <cmath>
+#include <random>
+#include <algorithm>
+
+#include "largeNeighbourhoodSearch.h"
+#include "regretInsertion.h"
+#include "localSearch.h"
+#include "tourUtils.h"
+#include "deadline.h"
+#include "incumbent.h"
+#include "searchCounters.h"
+
+namespace {
+    int clampedDestroyCount(const LnsParams &params, int tourSize, RunRng &g) {
+        std::uniform_real_distribution<double> fractionDist(params.destroyMin, std::max(params.destroyMin, params.destroyMax));
+        int k = static_cast<int>(std::lround(fractionDist(g) * tourSize));
+        return std::max(1, std::min(k, tourSize - 3));
+    }
+
+    std::vector<int> selectRandom(const std::vector<int> &tour, int k, RunRng &g) {
+        std::vector<int> nodes = tour;
+        std::shuffle(nodes.begin(), nodes.end(), g);
+        nodes.resize(k);
+        return nodes;
+    }
+
+    // Ranks nodes by what their removal saves and draws k with a bias towards the top (u^3 over the ranking)
+    std::vector<int> selectWorst(int **distanceMatrix, const std::vector<int> &costVector, const RegretInsertionTour &state,
+                                 const std::vector<int> &tour, int k, RunRng &g) {
+        std::vector<std::pair<int, int>> ranked; // (saving, node)
+        ranked.reserve(tour.size());
+        for (int x : tour) {
+            int p = state.prev[x], s = state.next[x];
+            ranked.push_back({costVector[x] + distanceMatrix[p][x] + distanceMatrix[x][s] - distanceMatrix[p][s], x});
+        }
+        std::sort(ranked.begin(), ranked.end(), [](const std::pair<int, int> &l, const std::pair<int, int> &r) {
+            return l.first > r.first || (l.first == r.first && l.second < r.second);
+        });
+
+        std::uniform_real_distribution<double> unit(0.0, 1.0);
+        std::vector<int> nodes;
+        for (int i = 0; i < k; ++i) {
+            double u = unit(g);
+            int index = static_cast<int>(u * u * u * ranked.size());
+            nodes.push_back(ranked[index].second);
+            ranked.erase(ranked.begin() + index);
+        }
+        return nodes;
+    }
+
+    // The k tour nodes closest to a random tour node (including itself)
+    std::vector<int> selectCluster(int **distanceMatrix, const std::vector<int> &tour, int k, RunRng &g) {
+        std::uniform_int_distribution<int> seedDist(0, static_cast<int>(tour.size()) - 1);
+        int seed = tour[seedDist(g)];
+        std::vector<int> nodes = tour;
+        std::partial_sort(nodes.begin(), nodes.begin() + k, nodes.end(), [&](int l, int r) {
+            int dl = distanceMatrix[seed][l], dr = distanceMatrix[seed][r];
+            return dl < dr || (dl == dr && l < r);
+        });
+        nodes.resize(k);
+        return nodes;
+    }
+}
+
+MultiStartResult largeNeighbourhoodSearch(int **distanceMatrix, const std::vector<int> &costVector, int size,
+                                          const LnsParams &params, int totalRuns, const MultiStartOptions &options)
+{
+    if (size <= 0) return MultiStartResult();
+
+    int nodesToVisit = getNodesToVisit(size);
+    std::vector<std::vector<int>> candidateList;
+    if (params.localSearch)
+        candidateList = createCandidateList(distanceMatrix, costVector, size, params.K);
+
+    return runMultiStart(totalRuns, [&](int, RunRng &g) -> RunResult {
+        std::uniform_int_distribution<int> startDist(0, size - 1);
+        RegretInsertionTour current(distanceMatrix, costVector, size);
+        current.start(startDist(g));
+        current.repair(nodesToVisit, params.alpha);
+
+        auto optimize = [&](RegretInsertionTour &state) {
+            if (!params.localSearch) return;
+            std::vector<int> solution = state.toSolution();
+            int solutionCost = runCandidateListSearch(distanceMatrix, costVector, candidateList, size, solution, state.cost);
+            state.assign(solution, solutionCost);
+        };
+        optimize(current);
+
+        RegretInsertionTour best = current;
+        Deadline &deadline = Deadline::current();
+        std::uniform_int_distribution<int> operatorDist(LnsParams::Random, LnsParams::Cluster);
+
+        if (nodesToVisit >= 5) {
+            for (int iteration = 0; iteration < params.iterations; ++iteration) {
+                std::vector<int> tour = current.toSolution();
+                int k = clampedDestroyCount(params, current.tourSize, g);
+                if (deadline.expired(static_cast<long>(k) * size)) break;
+                EC_COUNT(iterations, 1);
+
+                int op = params.destroy == LnsParams::Mixed ? operatorDist(g) : params.destroy;
+                std::vector<int> removed;
+                if (op == LnsParams::Worst)
+                    removed = selectWorst(distanceMatrix, costVector, current, tour, k, g);
+                else if (op == LnsParams::Cluster)
+                    removed = selectCluster(distanceMatrix, tour, k, g);
+                else
+                    removed = selectRandom(tour, k, g);
+
+                for (int x : removed)
+                    current.remove(x);
+                current.repair(nodesToVisit, params.alpha);
+                optimize(current);
+
+                if (current.cost < best.cost) {
+                    best = current;
+                    if (Incumbent::improves(best.cost)) {
+                        std::vector<int> solution = best.toSolution();
+                        Incumbent::publish(evaluateSolution(solution, distanceMatrix, costVector), solution);
+                    }
+                } else {
+                    current = best;
+                }
+            }
+        }
+
+        std::vector<int> solution = best.toSolution();
+        return {evaluateSolution(solution, distanceMatrix, costVector), solution};
+    }, options);
+}
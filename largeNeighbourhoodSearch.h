@@ -0,0 +1,34 @@
+#ifndef LARGE_NEIGHBOURHOOD_SEARCH_H
+#define LARGE_NEIGHBOURHOOD_SEARCH_H
+
+#include <vector>
+
+#include "multiStartRunner.h"
+
+struct LnsParams {
+    enum Destroy { Random = 0, Worst = 1, Cluster = 2, Mixed = 3 };
+
+    int iterations = 1000;       // destroy-repair rounds per run (the time budget may end a run earlier)
+    double destroyMin = 0.2;     // fraction of the tour removed per round, drawn from [destroyMin, destroyMax]
+    double destroyMax = 0.3;
+    int destroy = Mixed;         // Mixed draws one of the three operators per round
+    double alpha = 0.5;          // repair score alpha * regret - (1 - alpha) * best insertion cost, as in greedyWeightedRegret
+    bool localSearch = true;     // candidate-list steepest search after every repair
+    int K = 10;                  // candidate list size of that search
+};
+
+/**
+ * @brief Large neighbourhood search: destroy part of the tour, repair it by
+ * weighted 2-regret insertion, optionally re-optimize with the candidate-list
+ * steepest search (Assignment 4), keep the result if it is better.
+ * The initial tour is built by the same repair from a random start node.
+ *
+ * The repair keeps the insertion cache of RegretInsertionTour across rounds,
+ * so it costs O(k * size) for k destroyed nodes instead of a full regret
+ * construction.
+ */
+MultiStartResult largeNeighbourhoodSearch(int **distanceMatrix, const std::vector<int> &costVector, int size,
+                                          const LnsParams &params = LnsParams(), int totalRuns = 20,
+                                          const MultiStartOptions &options = MultiStartOptions::fromEnvironment());
+
+#endif
@@ -0,0 +1,225 @@
+#include <vector>
+#include <algorithm>
+
+#include "linKernighan.h"
+#include "localSearch.h"
+#include "tourUtils.h"
+#include "deadline.h"
+#include "instanceCache.h"
+
+#define dist(u, v) distanceMatrix[u][v]
+#define cost(n) costVector[n]
+
+// ExchangeOrder's bound is cost(v) + 2 * nearest(v), so (bound + cost) / 2 is exact
+LinKernighan::EntryOrder::EntryOrder(const ExchangeOrder &order, const std::vector<int> &costVector) {
+    std::vector<std::pair<int, int>> byBound;
+    for (int v : order.nodes()) byBound.push_back({(order.bound(v) + costVector[v]) / 2, v});
+    std::sort(byBound.begin(), byBound.end());
+    for (const auto &entry : byBound) {
+        bounds.push_back(entry.first);
+        nodes.push_back(entry.second);
+    }
+}
+
+LinKernighan::LinKernighan(int **distanceMatrix, const std::vector<int> &costVector,
+                           const std::vector<std::vector<int>> &candidateList, const EntryOrder &entryOrder, const LkParams &params)
+    : distanceMatrix(distanceMatrix), costVector(costVector), params(params), candidateList(candidateList), entryOrder(entryOrder),
+      tour(static_cast<int>(costVector.size())), stepBuffers(std::max(1, params.maxDepth)),
+      queued(costVector.size(), 0) {}
+
+bool LinKernighan::isAdded(int a, int b) const {
+    for (const auto &edge : added)
+        if ((edge.first == a && edge.second == b) || (edge.first == b && edge.second == a)) return true;
+    return false;
+}
+
+bool LinKernighan::wasExchanged(int v) const {
+    return std::find(exchanged.begin(), exchanged.end(), v) != exchanged.end();
+}
+
+void LinKernighan::activate(int v) {
+    if (!tour.contains(v) || queued[v]) return;
+    queued[v] = 1;
+    queue.push_back(v);
+}
+
+void LinKernighan::gatherSteps(int t1, int gain, std::vector<Step> &steps) {
+    steps.clear();
+    int end = tour.next(t1);
+    int y = tour.next(end);
+
+    for (int t3 : candidateList[end]) {
+        if (!tour.contains(t3) || t3 == t1 || t3 == y) continue;
+        int g1 = gain - dist(end, t3);
+        int t4 = tour.prev(t3);
+
+        // A 2-opt step that closes with a gain is kept even against the gain criterion: the candidate lists
+        // are not symmetric, so the rotation of the move that satisfies it may not be reachable
+        work++;
+        EC_COUNT(intraEvaluated, 1);
+        int closed = g1 + dist(t4, t3) - dist(t4, t1);
+        if ((g1 > 0 || closed > 0) && !isAdded(t4, t3))
+            steps.push_back({TwoOpt, t3, t4, -1, -1, g1 + dist(t4, t3), closed});
+        if (g1 <= 0) continue;
+
+        // Removing (t3, next(t3)) instead splits off the cycle end..t3; (t4, t5) and (t6, t1) join it back in
+        t4 = tour.next(t3);
+        if (t4 == t1 || isAdded(t3, t4)) continue;
+        int g2 = g1 + dist(t3, t4);
+        for (int t5 : candidateList[t4]) {
+            if (!tour.contains(t5) || t5 == t3 || !tour.between(end, t5, t3)) continue;
+            int g3 = g2 - dist(t4, t5);
+            if (g3 <= 0) continue;
+
+            work++;
+            EC_COUNT(intraEvaluated, 1);
+            int t6 = tour.next(t5);
+            if (!isAdded(t5, t6)) steps.push_back({SegmentSwap, t3, t4, t5, t6, g3 + dist(t5, t6), g3 + dist(t5, t6) - dist(t6, t1)});
+        }
+    }
+
+    // end leaves the tour and an unselected node takes its place; d(y, w) + cost(w) is at least w's bound
+    if (!params.exchanges || wasExchanged(end) || isAdded(end, y)) return;
+    int base = gain + dist(y, end) + cost(end);
+    for (size_t i = 0; i < entryOrder.nodes.size() && entryOrder.bounds[i] < base; ++i) {
+        int w = entryOrder.nodes[i];
+        if (tour.contains(w) || wasExchanged(w)) continue;
+        work++;
+        EC_COUNT(exchangeEvaluated, 1);
+        int gw = base - dist(y, w) - cost(w);
+        if (gw > 0) steps.push_back({Exchange, w, y, -1, -1, gw, gw - dist(w, t1)});
+    }
+}
+
+void LinKernighan::apply(int t1, const Step &step) {
+    int end = tour.next(t1);
+
+    if (step.type == TwoOpt) {
+        // t1 end .. t4 t3  ->  t1 t4 .. end t3
+        tour.reverse(end, step.t4);
+        log.push_back({false, end, step.t4});
+        added.push_back({end, step.t3});
+        touched.insert(touched.end(), {t1, end, step.t3, step.t4});
+    } else if (step.type == SegmentSwap) {
+        // t1 end .. t5 t6 .. t3 t4  ->  t1 t6 .. t3 end .. t5 t4, by three reversals
+        for (const auto &path : {std::make_pair(end, step.t3), std::make_pair(step.t3, step.t6), std::make_pair(step.t5, end)}) {
+            tour.reverse(path.first, path.second);
+            log.push_back({false, path.first, path.second});
+        }
+        added.push_back({end, step.t3});
+        added.push_back({step.t4, step.t5});
+        touched.insert(touched.end(), {t1, end, step.t3, step.t4, step.t5, step.t6});
+    } else {
+        tour.replace(end, step.t3);
+        log.push_back({true, end, step.t3});
+        added.push_back({step.t4, step.t3});
+        exchanged.insert(exchanged.end(), {end, step.t3});
+        touched.insert(touched.end(), {t1, step.t3, step.t4});
+    }
+}
+
+void LinKernighan::rollback(size_t logSize) {
+    while (log.size() > logSize) {
+        const Change &change = log.back();
+        if (change.exchange)
+            tour.replace(change.b, change.a);
+        else
+            tour.reverse(change.b, change.a);
+        log.pop_back();
+    }
+}
+
+bool LinKernighan::chain(int t1, int depth, int gain) {
+    std::vector<Step> &steps = stepBuffers[depth];
+    gatherSteps(t1, gain, steps);
+
+    // Steps that already close with a gain first, so the chain never misses a plain improving move; then the
+    // highest open gain, which looks one edge ahead of the gain criterion
+    size_t breadth = std::min(steps.size(), static_cast<size_t>(depth == 0 ? 5 : depth == 1 ? 3 : 1));
+    std::partial_sort(steps.begin(), steps.begin() + breadth, steps.end(), [](const Step &l, const Step &r) {
+        if ((l.closed > 0) != (r.closed > 0)) return l.closed > 0;
+        return l.closed > 0 ? l.closed > r.closed : l.gain > r.gain;
+    });
+
+    for (size_t s = 0; s < breadth; ++s) {
+        Step step = steps[s];
+        size_t logSize = log.size(), addedSize = added.size(), touchedSize = touched.size(), exchangedSize = exchanged.size();
+
+        apply(t1, step);
+        EC_COUNT(improvingFound, step.closed > bestGain);
+        if (step.closed > bestGain) {
+            bestGain = step.closed;
+            bestLog = log.size();
+            bestTouched = touched.size();
+        }
+
+        if (depth + 1 < static_cast<int>(stepBuffers.size()) && chain(t1, depth + 1, step.gain)) return true;
+        if (bestGain > 0) {
+            rollback(bestLog);
+            return true;
+        }
+
+        rollback(logSize);
+        added.resize(addedSize);
+        touched.resize(touchedSize);
+        exchanged.resize(exchangedSize);
+    }
+    return false;
+}
+
+int LinKernighan::improve(std::vector<int> &solution, int cost) {
+    if (solution.size() < 5) return cost;
+
+    tour.assign(solution);
+    queue.clear();
+    std::fill(queued.begin(), queued.end(), 0);
+    for (int v : solution) activate(v);
+
+    Deadline &deadline = Deadline::current();
+    work = 0;
+    while (!queue.empty() && !deadline.expired(work)) {
+        work = 0;
+        int t1 = queue.front();
+        queue.pop_front();
+        queued[t1] = 0;
+        if (!tour.contains(t1)) continue;
+        EC_COUNT(iterations, 1);
+
+        // Both tour edges of t1 start a chain; the second one after walking the tour the other way
+        for (int side = 0; side < 2; ++side) {
+            if (side == 1) tour.flipOrientation();
+            log.clear();
+            added.clear();
+            touched.clear();
+            exchanged.clear();
+            bestGain = 0;
+
+            if (chain(t1, 0, dist(t1, tour.next(t1)))) {
+                cost -= bestGain;
+                EC_COUNT(movesApplied, 1);
+                touched.resize(bestTouched);
+                for (int v : touched) activate(v);
+                break;
+            }
+        }
+    }
+
+    solution = tour.toSolution();
+    return cost;
+}
+
+MultiStartResult linKernighan(int **distanceMatrix, const std::vector<int> &costVector, int size,
+                              const LkParams &params, int totalRuns, const MultiStartOptions &options)
+{
+    if (size <= 0) return MultiStartResult();
+
+    std::vector<std::vector<int>> candidateList = createCandidateList(distanceMatrix, costVector, size, params.K);
+    LinKernighan::EntryOrder entryOrder(*InstanceCache::shared().exchangeOrder(distanceMatrix, costVector, size), costVector);
+
+    return runMultiStart(totalRuns, [&](int, RunRng &g) -> RunResult {
+        std::vector<int> solution = randomPermutation(size, g);
+        LinKernighan search(distanceMatrix, costVector, candidateList, entryOrder, params);
+        int cost = search.improve(solution, evaluateSolution(solution, distanceMatrix, costVector));
+        return {cost, solution};
+    }, options);
+}
@@ -0,0 +1,106 @@
+#ifndef LIN_KERNIGHAN_H
+#define LIN_KERNIGHAN_H
+
+#include <deque>
+#include <vector>
+
+#include "multiStartRunner.h"
+#include "arrayTour.h"
+#include "exchangeOrder.h"
+
+struct LkParams {
+    int K = 10;            // candidate neighbours per node (createCandidateList), for the 2-opt and 3-opt steps
+    int maxDepth = 50;     // steps per chain
+    bool exchanges = true; // in/out node exchanges as chain steps
+};
+
+/**
+ * @brief Lin-Kernighan style variable-depth search for the selective cycle.
+ * A chain starts by removing a tour edge (t1, t2) and keeps the tour closed
+ * through t1 after every step, so its current end is always next(t1):
+ *  - 2-opt step: add (end, t3) for a candidate t3, remove (prev(t3), t3);
+ *  - 3-opt step: add (end, t3), remove (t3, next(t3)) and close the cycle this
+ *    opens with (next(t3), t5), t5 a candidate between end and t3, so the two
+ *    segments swap places without reversal;
+ *  - exchange step: an unselected node w takes end's place next to end's
+ *    other neighbour y, so node selection changes inside the chain. The
+ *    entering nodes are not taken from y's candidate list, which holds few
+ *    unselected nodes, but from all nodes in the order of the least they can
+ *    add, cost(w) plus the distance to w's nearest node, up to the first that
+ *    cannot keep the gain positive.
+ * A step is only taken while the gain of the removed minus the added edges
+ * (and node costs) stays positive, edges added by the chain are not removed
+ * again and exchanged nodes do not come back. The chain goes on greedily up to
+ * maxDepth steps, keeps the prefix with the best closed gain if it is
+ * positive, and otherwise backtracks over the alternatives of its first two
+ * steps (5 and 3 of them, as in the original LK). Nodes whose edges a chain
+ * changed get their don't-look bit cleared; the search ends when every node
+ * has failed as t1 in both directions.
+ */
+class LinKernighan {
+public:
+    // Nodes by the least they add when entering the tour (cost plus the distance to their nearest node), with that bound
+    struct EntryOrder {
+        std::vector<int> nodes;
+        std::vector<int> bounds; // bounds[i] belongs to nodes[i]
+
+        EntryOrder(const ExchangeOrder &order, const std::vector<int> &costVector);
+    };
+
+    // candidateList (createCandidateList) and entryOrder must outlive the search; params.K is not read here
+    LinKernighan(int **distanceMatrix, const std::vector<int> &costVector, const std::vector<std::vector<int>> &candidateList,
+                 const EntryOrder &entryOrder, const LkParams &params);
+
+    // Improves the tour in place until no chain gains; returns its objective
+    int improve(std::vector<int> &solution, int cost);
+
+private:
+    enum StepType { TwoOpt, SegmentSwap, Exchange };
+
+    struct Step {
+        StepType type;
+        int t3, t4, t5, t6; // Exchange: t3 enters, t4 is y
+        int gain;           // open gain after the step, before closing at t1
+        int closed;         // gain of the tour closed at t1 after the step
+    };
+
+    // A reversal (undone by reversing b..a) or an exchange (u left, w entered)
+    struct Change {
+        bool exchange;
+        int a, b;
+    };
+
+    bool chain(int t1, int depth, int gain);
+    void gatherSteps(int t1, int gain, std::vector<Step> &steps);
+    void apply(int t1, const Step &step);
+    void rollback(size_t logSize);
+    bool isAdded(int a, int b) const;
+    bool wasExchanged(int v) const;
+    void activate(int v);
+
+    int **distanceMatrix;
+    const std::vector<int> &costVector;
+    LkParams params;
+    const std::vector<std::vector<int>> &candidateList;
+    const EntryOrder &entryOrder;
+    ArrayTour tour;
+
+    // State of the chain being built from the current t1
+    std::vector<Change> log;
+    std::vector<std::pair<int, int>> added;
+    std::vector<int> touched;   // endpoints of the changed edges, for the don't-look bits
+    std::vector<int> exchanged; // nodes that left or entered the tour in this chain
+    std::vector<std::vector<Step>> stepBuffers; // one per depth
+    int bestGain = 0;
+    size_t bestLog = 0, bestTouched = 0;
+    long work = 0;
+
+    std::deque<int> queue; // nodes whose don't-look bit is off
+    std::vector<char> queued;
+};
+
+MultiStartResult linKernighan(int **distanceMatrix, const std::vector<int> &costVector, int size,
+                              const LkParams &params = LkParams(), int totalRuns = 200,
+                              const MultiStartOptions &options = MultiStartOptions::fromEnvironment());
+
+#endif
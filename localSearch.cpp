@@ -0,0 +1,944 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <limits>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+
+#include "localSearch.h"
+#include "constructors.h"
+#include "constructionCache.h"
+#include "candidateListCache.h"
+#include "instanceCache.h"
+#include "tourUtils.h"
+#include "localSearchCore.h"
+
+// ==================== ASSIGNMENT 3: STEEPEST / GREEDY LOCAL SEARCH ====================
+
+/*****************************************************************************************
+-----------------------------------------------------------------------------
+ * METHODS OVERVIEW
+ * -----------------------------------------------------------------------------
+ *
+ * M1 (Kuba)
+ *   Type: Steepest Descent
+ *   Move: Two-Nodes Exchange
+ *   Start: Random
+ *   Description:
+ *     - Generate random feasible solution
+ *     - Evaluate all intra-route node swaps and inter-route exchanges
+ *     - Apply the move with the best (lowest) delta until no improvement remains
+ *
+ * M2 (Kuba)
+ *   Type: Steepest Descent
+ *   Move: Two-Nodes Exchange
+ *   Start: Greedy (random start node)
+ *   Description:
+ *     - Start from greedy construction heuristic with random start node
+ *     - Explore all intra-route swaps and inter-route exchanges
+ *     - Apply best improving move each iteration until local optimum
+ *
+ * M3 (Kuba)
+ *   Type: Steepest Descent
+ *   Move: Two-Edges Exchange (2-opt)
+ *   Start: Random
+ *   Description:
+ *     - Start from random feasible solution
+ *     - Evaluate all 2-opt intra-route moves and inter-route exchanges
+ *     - Apply the best improving move until no improvement remains
+ *
+ * M4 (Kuba)
+ *   Type: Steepest Descent
+ *   Move: Two-Edges Exchange (2-opt)
+ *   Start: Greedy (random start node)
+ *   Description:
+ *     - Start from greedy heuristic solution (random start node)
+ *     - Explore all 2-opt intra-route and inter-route exchanges
+ *     - Apply best improving move each iteration until local optimum
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * M5 (Mari)
+ *   Type: Greedy (First Improvement)
+ *   Move: Two-Nodes Exchange
+ *   Start: Random
+ *   Description:
+ *     - Start from random feasible solution
+ *     - Randomly mix intra-route node swaps and inter-route exchanges
+ *     - Apply the first improving move found
+ *     - Stop when no improving move exists
+ *
+ * M6 (Mari)
+ *   Type: Greedy (First Improvement)
+ *   Move: Two-Nodes Exchange
+ *   Start: Greedy (random start node)
+ *   Description:
+ *     - Start from greedy solution with random start node
+ *     - Browse intra- and inter-route node exchanges in random order
+ *     - Apply first improving move; stop when local optimum reached
+ *
+ * M7 (Mari)
+ *   Type: Greedy (First Improvement)
+ *   Move: Two-Edges Exchange (2-opt)
+ *   Start: Random
+ *   Description:
+ *     - Start from random feasible solution
+ *     - Randomly shuffle all 2-opt intra-route moves and inter-route exchanges
+ *     - Apply first improving move; repeat until no further improvement
+ *
+ * M8 (Mari)
+ *   Type: Greedy (First Improvement)
+ *   Move: Two-Edges Exchange (2-opt)
+ *   Start: Greedy (random start node)
+ *   Description:
+ *     - Start from greedy heuristic solution (random start node)
+ *     - Randomly mix 2-opt intra-route and inter-route exchanges
+ *     - Apply first improving move that reduces objective value
+ ***************************************************************************************/
+MultiStartResult M1_steepestDescent_TwoNodeExchange_RandomStart(int **distanceMatrix, const std::vector<int> &costVector, int size, int totalRuns,
+    const MultiStartOptions &options)
+{
+    return LocalSearch<TwoNodeExchange, SteepestDescent, RandomStart>::run(distanceMatrix, costVector, size, totalRuns, options);
+}
+
+MultiStartResult M2_steepestDescent_TwoNodeExchange_GreedyStart(int **distanceMatrix, const std::vector<int> &costVector, int size, int totalRuns,
+    const MultiStartOptions &options)
+{
+    return LocalSearch<TwoNodeExchange, SteepestDescent, GreedyStart>::run(distanceMatrix, costVector, size, totalRuns, options, "M2_localOptimum");
+}
+
+MultiStartResult M3_steepestDescent_TwoEdgeExchange_RandomStart(int **distanceMatrix, const std::vector<int> &costVector, int size, int totalRuns,
+    const MultiStartOptions &options, bool prune)
+{
+    if (prune)
+        return LocalSearch<TwoEdgeExchangePruned, SteepestDescent, RandomStart>::run(distanceMatrix, costVector, size, totalRuns, options);
+    return LocalSearch<TwoEdgeExchange, SteepestDescent, RandomStart>::run(distanceMatrix, costVector, size, totalRuns, options);
+}
+
+MultiStartResult M4_steepestDescent_TwoEdgeExchange_GreedyStart(int **distanceMatrix, const std::vector<int> &costVector, int size, int totalRuns,
+    const MultiStartOptions &options, bool prune)
+{
+    if (prune)
+        return LocalSearch<TwoEdgeExchangePruned, SteepestDescent, GreedyStart>::run(distanceMatrix, costVector, size, totalRuns, options, "M4_pruned_localOptimum");
+    return LocalSearch<TwoEdgeExchange, SteepestDescent, GreedyStart>::run(distanceMatrix, costVector, size, totalRuns, options, "M4_localOptimum");
+}
+
+MultiStartResult M5_greedyFirstImprovement_TwoNodeExchange_RandomStart(int **distanceMatrix, const std::vector<int> &costVector, int size, int totalRuns,
+    const MultiStartOptions &options)
+{
+    return LocalSearch<TwoNodeExchange, FirstImprovement, RandomStart>::run(distanceMatrix, costVector, size, totalRuns, options);
+}
+
+MultiStartResult M6_greedyFirstImprovement_TwoNodeExchange_GreedyStart(int **distanceMatrix, const std::vector<int> &costVector, int size, int totalRuns,
+    const MultiStartOptions &options)
+{
+    return LocalSearch<TwoNodeExchange, FirstImprovement, GreedyStart>::run(distanceMatrix, costVector, size, totalRuns, options);
+}
+
+MultiStartResult M7_greedyFirstImprovement_TwoEdgeExchange_RandomStart(int **distanceMatrix, const std::vector<int> &costVector, int size, int totalRuns,
+    const MultiStartOptions &options, bool prune)
+{
+    if (prune)
+        return LocalSearch<TwoEdgeExchangePruned, FirstImprovement, RandomStart>::run(distanceMatrix, costVector, size, totalRuns, options);
+    return LocalSearch<TwoEdgeExchange, FirstImprovement, RandomStart>::run(distanceMatrix, costVector, size, totalRuns, options);
+}
+
+MultiStartResult M8_greedyFirstImprovement_TwoEdgeExchange_GreedyStart(int **distanceMatrix, const std::vector<int> &costVector, int size, int totalRuns,
+    const MultiStartOptions &options, bool prune)
+{
+    if (prune)
+        return LocalSearch<TwoEdgeExchangePruned, FirstImprovement, GreedyStart>::run(distanceMatrix, costVector, size, totalRuns, options);
+    return LocalSearch<TwoEdgeExchange, FirstImprovement, GreedyStart>::run(distanceMatrix, costVector, size, totalRuns, options);
+}
+
+// ==================== ASSIGNMENT 4: CANDIDATE MOVES ====================
+
+/**
+ * @brief Creates a candidate list for local search.
+ * For each vertex u, finds the K nearest vertices v based on the
+ * metric: distanceMatrix[u][v] + costVector[v].
+ *
+ * @param distanceMatrix The n x n distance matrix.
+ * @param costVector The cost vector of size n.
+ * @param size The number of vertices (n).
+ * @param K The number of nearest neighbors to store.
+ * @return std::vector<std::vector<int>> A list where candidateList[u]
+ * contains the K nearest neighbors of u.
+ * With the CandidateListCache enabled (resident instances), each list is built once.
+ */
+std::vector<std::vector<int>> createCandidateList(int **distanceMatrix, const std::vector<int> &costVector, int size, int K)
+{
+    CandidateListCache &cache = CandidateListCache::shared();
+    if (cache.isEnabled() && static_cast<int>(costVector.size()) == size)
+        return cache.getOrBuild(distanceMatrix, costVector, K, [&]() { return buildCandidateList(distanceMatrix, costVector, size, K); });
+    return buildCandidateList(distanceMatrix, costVector, size, K);
+}
+
+// The candidate list of u: the K best v by distance + cost, ties by node id (the order of the (metric, v) pairs)
+static void buildCandidateRow(int **distanceMatrix, const std::vector<int> &costVector, int size, int K, int u, std::vector<int> &row)
+{
+    std::vector<std::pair<int, int>> neighbors;
+    neighbors.reserve(size - 1);
+
+    for (int v = 0; v < size; ++v)
+    {
+        if (u == v) continue;
+        // Metric: distance to v + cost of visiting v
+        int metric = distanceMatrix[u][v] + costVector[v];
+        neighbors.push_back({metric, v});
+    }
+
+    // Sort the K best neighbors by the metric (lowest first); the pairs are distinct, so the order is that of a full sort
+    int kept = std::max(0, std::min((int)neighbors.size(), K));
+    std::partial_sort(neighbors.begin(), neighbors.begin() + kept, neighbors.end());
+
+    // Add the K best neighbors to the candidate list for u
+    row.clear();
+    for (int i = 0; i < kept; ++i)
+    {
+        row.push_back(neighbors[i].second);
+    }
+}
+
+std::vector<std::vector<int>> buildCandidateList(int **distanceMatrix, const std::vector<int> &costVector, int size, int K)
+{
+    std::vector<std::vector<int>> candidateList(size);
+    for (int u = 0; u < size; ++u)
+        buildCandidateRow(distanceMatrix, costVector, size, K, u, candidateList[u]);
+    return candidateList;
+}
+
+/**
+ * A list that holds no changed node is still the top K of the unchanged
+ * nodes, whose metric did not move, so the changed nodes are merged into it
+ * by their new metric. Lists that hold a changed node, and those of moved
+ * nodes, are rebuilt: about |changed| * K lists of O(size) each.
+ */
+void updateCandidateList(int **distanceMatrix, const std::vector<int> &costVector, int size, int K,
+                         std::vector<std::vector<int>> &candidateList, const std::vector<int> &changed, const std::vector<int> &moved)
+{
+    std::vector<char> isChanged(size, 0), isMoved(size, 0);
+    std::vector<int> nodes;
+    for (int v : changed)
+        if (!isChanged[v]) {
+            isChanged[v] = 1;
+            nodes.push_back(v);
+        }
+    for (int v : moved) isMoved[v] = 1;
+
+    int kept = std::max(0, std::min(size - 1, K));
+    for (int u = 0; u < size; ++u)
+    {
+        std::vector<int> &row = candidateList[u];
+        if (isMoved[u] || std::any_of(row.begin(), row.end(), [&](int v) { return isChanged[v]; }))
+        {
+            buildCandidateRow(distanceMatrix, costVector, size, K, u, row);
+            continue;
+        }
+
+        auto before = [&](int a, int b) {
+            int ma = distanceMatrix[u][a] + costVector[a], mb = distanceMatrix[u][b] + costVector[b];
+            return ma != mb ? ma < mb : a < b;
+        };
+        for (int v : nodes)
+        {
+            if (v == u || (static_cast<int>(row.size()) == kept && !before(v, row.back()))) continue;
+            row.insert(std::upper_bound(row.begin(), row.end(), v, before), v);
+            if (static_cast<int>(row.size()) > kept) row.pop_back();
+        }
+    }
+}
+
+// Helper macros for readability in delta calculations
+#define dist(u, v) distanceMatrix[u][v]
+#define cost(n) costVector[n]
+
+// Or-opt: segment sf..sl leaves p -> sf..sl -> q and goes between c and d, as c-sf..sl-d or (reversed) c-sl..sf-d
+static inline int orOptDelta(int **distanceMatrix, int p, int sf, int sl, int q, int c, int d, bool reversed)
+{
+    int inserted = reversed ? dist(c, sl) + dist(sf, d) : dist(c, sf) + dist(sl, d);
+    return dist(p, q) - dist(p, sf) - dist(sl, q) + inserted - dist(c, d);
+}
+
+// Best move of one candidate-list scan; phase 1 is the or-3opt pass, which comes after all other moves
+struct CandidateBest {
+    int delta = 0;
+    int phase = 0;
+    int moveType = 0; // 0=none, 1/2=intra, 3/4=inter, 5=or-opt, 6=or-3opt
+    int u_pos = -1, v_pos = -1;             // intra-route
+    int replace_pos = -1, newNode = -1;     // inter-route
+    int seg_start = -1, seg_len = 0, after = -1; // or-opt and or-3opt
+    bool reversed = false;
+};
+
+int runCandidateListSearch(
+    int **distanceMatrix,
+    const std::vector<int> &costVector,
+    const std::vector<std::vector<int>>& candidateList,
+    int size,
+    std::vector<int> &solution,
+    int currentCost,
+    bool orOpt,
+    bool or3Opt,
+    ScanTeam *team)
+{
+    int solSize = static_cast<int>(solution.size());
+    if (solSize <= 1) return currentCost;
+
+    Deadline &deadline = Deadline::current();
+
+    bool improved = true;
+    while (improved && !deadline.reached())
+    {
+        improved = false;
+        EC_COUNT(iterations, 1);
+
+        std::vector<char> used(size, 0);
+        std::vector<int> sol_pos(size, -1);
+        for (int i = 0; i < solSize; ++i) {
+            used[solution[i]] = 1;
+            sol_pos[solution[i]] = i;
+        }
+
+        // Candidate moves from the positions [begin, end), then or-3opt moves from the same positions
+        auto scan = [&](int begin, int end, CandidateBest &best) {
+            Deadline &deadline = Deadline::current();
+            for (int u_pos = begin; u_pos < end; ++u_pos)
+            {
+                if (deadline.expired(static_cast<long>(candidateList[solution[u_pos]].size()))) break;
+                int u = solution[u_pos];
+
+                for (int v : candidateList[u])
+                {
+                    if (u == v) continue;
+
+                    if (used[v])
+                    {
+                        int v_pos = sol_pos[v];
+
+                        if ((u_pos + 1) % solSize == v_pos || (v_pos + 1) % solSize == u_pos) continue;
+
+                        int u_prev_pos = (u_pos - 1 + solSize) % solSize;
+                        int u_next_pos = (u_pos + 1) % solSize;
+                        int v_prev_pos = (v_pos - 1 + solSize) % solSize;
+                        int v_next_pos = (v_pos + 1) % solSize;
+
+                        if (u_prev_pos != v_pos && v_prev_pos != u_pos)
+                        {
+                            int u_prev = solution[u_prev_pos];
+                            int v_prev = solution[v_prev_pos];
+                            int delta = (dist(u_prev, v_prev) + dist(u, v)) - (dist(u_prev, u) + dist(v_prev, v));
+                            EC_COUNT(intraEvaluated, 1);
+                            EC_COUNT(improvingFound, delta < 0);
+                            if (delta < best.delta) best = {delta, 0, 1, u_pos, v_prev_pos};
+                        }
+
+
+                        if (u_next_pos != v_pos && v_next_pos != u_pos)
+                        {
+                            int u_next = solution[u_next_pos];
+                            int v_next = solution[v_next_pos];
+                            int delta = (dist(u, v) + dist(u_next, v_next)) - (dist(u, u_next) + dist(v, v_next));
+                            EC_COUNT(intraEvaluated, 1);
+                            EC_COUNT(improvingFound, delta < 0);
+                            if (delta < best.delta) best = {delta, 0, 2, u_next_pos, v_pos};
+                        }
+
+                        if (!orOpt) continue;
+
+                        // Or-opt: a segment with v at one end goes next to u, so that (u, v) becomes an edge
+                        for (int len = 1; len <= MAX_OR_OPT_LENGTH && len + 3 <= solSize; ++len)
+                        {
+                            for (int vAtEnd = 0; vAtEnd < (len == 1 ? 1 : 2); ++vAtEnd)
+                            {
+                                int seg_start = vAtEnd ? (v_pos - len + 1 + solSize) % solSize : v_pos;
+                                auto inSegment = [&](int position) { return (position - seg_start + solSize) % solSize < len; };
+                                if (inSegment(u_pos)) continue;
+
+                                int sf = solution[seg_start];
+                                int sl = solution[(seg_start + len - 1) % solSize];
+                                int p = solution[(seg_start - 1 + solSize) % solSize];
+                                int q = solution[(seg_start + len) % solSize];
+
+                                // Before u, v must come last; after u, v must come first
+                                for (int after = 0; after < 2; ++after)
+                                {
+                                    int c_pos = after ? u_pos : u_prev_pos;
+                                    int d_pos = after ? u_next_pos : u_pos;
+                                    if (inSegment(c_pos) || inSegment(d_pos)) continue;
+
+                                    bool reversed = after ? (v != sf) : (v != sl);
+                                    int delta = orOptDelta(distanceMatrix, p, sf, sl, q, solution[c_pos], solution[d_pos], reversed);
+                                    EC_COUNT(intraEvaluated, 1);
+                                    EC_COUNT(improvingFound, delta < 0);
+                                    if (delta < best.delta) best = {delta, 0, 5, -1, -1, -1, -1, seg_start, len, solution[c_pos], reversed};
+                                }
+                            }
+                        }
+                    }
+                    else
+                    {
+                        if (solSize < 3) continue;
+
+                        int u_prev_pos = (u_pos - 1 + solSize) % solSize;
+                        int u_next_pos = (u_pos + 1) % solSize;
+                    
+                        // Move B1: Replace u's *successor* (u_next) with v. Creates (u, v).
+                        int w_pos = u_next_pos;
+                        int w = solution[w_pos];
+                        int w_next_pos = (w_pos + 1) % solSize;
+                        int w_next = solution[w_next_pos];
+                        int delta = (dist(u, v) + dist(v, w_next) + cost(v)) - (dist(u, w) + dist(w, w_next) + cost(w));
+                        EC_COUNT(exchangeEvaluated, 1);
+                        EC_COUNT(improvingFound, delta < 0);
+                        if (delta < best.delta) best = {delta, 0, 3, -1, -1, w_pos, v};
+
+                        // Move B2: Replace u's *predecessor* (u_prev) with v. Creates (v, u).
+                        w_pos = u_prev_pos;
+                        w = solution[w_pos];
+                        int w_prev_pos = (w_pos - 1 + solSize) % solSize;
+                        int w_prev = solution[w_prev_pos];
+                        delta = (dist(w_prev, v) + dist(v, u) + cost(v)) - (dist(w_prev, w) + dist(w, u) + cost(w));
+                        EC_COUNT(exchangeEvaluated, 1);
+                        EC_COUNT(improvingFound, delta < 0);
+                        if (delta < best.delta) best = {delta, 0, 4, -1, -1, w_pos, v};
+                    }
+                } // end for v
+            } // end for u_pos
+
+            // Or-3opt: a -> b..c -> d..e -> f becomes a -> d..e -> b..c -> f, with d a candidate of a and e a candidate
+            // of b. Each new edge must keep the partial gain positive, which prunes most pairs before f is looked at.
+            // dir = -1 walks the tour backwards, which mirrors the move so that b is a's predecessor.
+            for (int a_pos = begin; or3Opt && a_pos < end && solSize >= 4; ++a_pos)
+            {
+                int a = solution[a_pos];
+                if (deadline.expired(2 * static_cast<long>(candidateList[a].size()))) break;
+
+                for (int dir = 1; dir >= -1; dir -= 2)
+                {
+                    auto offset = [&](int position) { return ((position - a_pos) * dir % solSize + solSize) % solSize; };
+                    auto step = [&](int position, int k) { return ((position + dir * k) % solSize + solSize) % solSize; };
+                    int b_pos = step(a_pos, 1);
+                    int b = solution[b_pos];
+
+                    for (int d : candidateList[a])
+                    {
+                        if (!used[d]) continue;
+                        int g1 = dist(a, b) - dist(a, d);
+                        if (g1 <= 0) continue;
+                        int d_offset = offset(sol_pos[d]);
+                        if (d_offset < 2) continue; // d is b, or a itself
+                        int c_pos = step(sol_pos[d], -1);
+                        int c = solution[c_pos];
+
+                        for (int e : candidateList[b])
+                        {
+                            // e closes the segment starting at d, so it lies between d and a
+                            if (!used[e] || offset(sol_pos[e]) < d_offset) continue;
+                            int g2 = g1 + dist(c, d) - dist(b, e);
+                            if (g2 <= 0) continue;
+
+                            int f = solution[step(sol_pos[e], 1)];
+                            int delta = dist(c, f) - dist(e, f) - g2;
+                            EC_COUNT(intraEvaluated, 1);
+                            EC_COUNT(improvingFound, delta < 0);
+                            // Forwards, b..c goes after e; backwards, the segment is c..b and goes after f
+                            if (delta < best.delta)
+                                best = {delta, 1, 6, -1, -1, -1, -1, dir == 1 ? b_pos : c_pos, d_offset - 1, dir == 1 ? e : f, false};
+                        }
+                    }
+                }
+            }
+        };
+
+        CandidateBest best;
+        if (!team || team->parts() == 1) {
+            scan(0, solSize, best);
+        } else {
+            std::vector<CandidateBest> partBest(team->parts());
+            team->run([&](int part) {
+                std::pair<int, int> positions = team->range(part, solSize);
+                scan(positions.first, positions.second, partBest[part]);
+            });
+            // Lowest delta, earlier phase, earlier part: the move the serial scan keeps
+            for (const CandidateBest &candidate : partBest)
+                if (candidate.delta < best.delta || (candidate.delta == best.delta && candidate.phase < best.phase))
+                    best = candidate;
+        }
+
+        // --- Apply the single best move found ---
+        if (best.delta < 0)
+        {
+            improved = true;
+            currentCost += best.delta;
+            EC_COUNT(movesApplied, 1);
+
+            if (best.moveType == 1) // Intra-route A1: reverse [u_pos...v_prev_pos]
+            {
+                reverseCircularSegment(solution, best.u_pos, best.v_pos);
+            }
+            else if (best.moveType == 2) // Intra-route A2: reverse [u_next_pos...v_pos]
+            {
+                reverseCircularSegment(solution, best.u_pos, best.v_pos);
+            }
+            else if (best.moveType == 3 || best.moveType == 4) // Inter-route B1/B2
+            {
+                solution[best.replace_pos] = best.newNode;
+            }
+            else if (best.moveType == 5 || best.moveType == 6) // Or-opt, or-3opt
+            {
+                relocateSegment(solution, best.seg_start, best.seg_len, best.after, best.reversed);
+            }
+        }
+    } // end while(improved)
+
+    return currentCost;
+}
+
+MultiStartResult M_Steepest_CandidateList_RandomStart(
+    int **distanceMatrix,
+    const std::vector<int> &costVector,
+    const std::vector<std::vector<int>>& candidateList,
+    int size,
+    int totalRuns,
+    const MultiStartOptions &options,
+    bool orOpt,
+    bool or3Opt)
+{
+    if (size <= 0) return MultiStartResult();
+
+    int scanParts = scanTeamSize(options, size, totalRuns);
+
+    MultiStartResult result = runMultiStart(totalRuns, [&](int run, RunRng &g) -> RunResult
+    {
+        std::vector<int> solution = randomPermutation(size, g);
+        int solSize = static_cast<int>(solution.size());
+        if (solSize <= 1) return {0, {}};
+
+        int currentCost = evaluateSolution(solution, distanceMatrix, costVector);
+        std::unique_ptr<ScanTeam> team = scanParts > 1 ? std::make_unique<ScanTeam>(scanParts) : nullptr;
+        currentCost = runCandidateListSearch(distanceMatrix, costVector, candidateList, size, solution, currentCost, orOpt, or3Opt, team.get());
+
+        return {currentCost, solution};
+    }, options);
+
+    return result;
+}
+#undef dist
+#undef cost
+
+// ==================== ASSIGNMENT 5: LM & LAZY EVAL LOGIC ====================
+
+bool compareMoves(const Move &a, const Move &b) {
+    return a.delta < b.delta;
+}
+
+// Returns: 1 (Forward), -1 (Reversed), 0 (Broken/Non-existent)
+int checkEdge(int u, int v, const std::vector<int>& sol, const std::vector<int>& pos) {
+    int n = sol.size();
+    int u_idx = pos[u];
+    int v_idx = pos[v];
+
+    if (u_idx == -1 || v_idx == -1) return 0; 
+
+    int u_next_idx = (u_idx + 1) % n;
+    int u_prev_idx = (u_idx - 1 + n) % n;
+
+    if (u_next_idx == v_idx) return 1;  
+    if (u_prev_idx == v_idx) return -1; 
+    return 0;
+}
+
+#define dist(a, b) distanceMatrix[a][b]
+#define cost(a) costVector[a]
+
+void generateMoves(
+    int **distanceMatrix,
+    const std::vector<int> &costVector,
+    const std::vector<int> &solution,
+    const std::vector<int> &pos, // pos[node] = index in solution, or -1 if not in solution
+    std::vector<Move> &LM,
+    bool fullScan,
+    int totalNodes, // Total nodes in problem instance (not just solution size)
+    const std::vector<int> &nodesToCheck, // Only used if !fullScan
+    bool orOpt,
+    const NeighbourLists *neighbourLists,
+    const ExchangeOrder *exchangeOrder)
+{
+    int n = solution.size();
+
+    // We need two scanning logics:
+    // 1. Intra-Route (2-opt): Scan edges inside solution
+    // 2. Inter-Route (Node Exchange): Scan nodes IN solution vs nodes OUT of solution
+
+    auto addInterMoves = [&](int u_idx) {
+        int u = solution[u_idx];
+        int u_prev = solution[(u_idx - 1 + n) % n];
+        int u_next = solution[(u_idx + 1) % n];
+
+        if (exchangeOrder && n > 1) {
+            // By bound until none can gain, then back into node order, so LM is built as by the plain loop
+            int share = dist(u_prev, u) + dist(u, u_next) + cost(u);
+            size_t first = LM.size();
+            const std::vector<int> &byBound = exchangeOrder->nodes();
+            for (auto it = byBound.begin(); it != byBound.end(); ++it) {
+                int v = *it;
+                if (exchangeOrder->bound(v) >= share) {
+                    EC_COUNT(exchangeSkipped, byBound.end() - it);
+                    break;
+                }
+                if (pos[v] != -1) continue;
+                int delta = dist(u_prev, v) + dist(v, u_next) + cost(v) - share;
+                EC_COUNT(exchangeEvaluated, 1);
+                if (delta < 0) {
+                    EC_COUNT(improvingFound, 1);
+                    LM.push_back({2, delta, u, -1, v, -1});
+                }
+            }
+            std::sort(LM.begin() + first, LM.end(), [](const Move &l, const Move &r) { return l.v < r.v; });
+            return;
+        }
+        
+        // Check against all nodes NOT in solution
+        for (int v = 0; v < totalNodes; ++v) {
+            if (pos[v] != -1) continue; // v is already in solution
+
+            // Delta = New Cost - Old Cost
+            // Remove u: -(dist(u_prev, u) + dist(u, u_next) + cost(u))
+            // Add v:    +(dist(u_prev, v) + dist(v, u_next) + cost(v))
+            
+            int current_cost = dist(u_prev, u) + dist(u, u_next) + cost(u);
+            int new_cost = dist(u_prev, v) + dist(v, u_next) + cost(v);
+            
+            int delta = new_cost - current_cost;
+            EC_COUNT(exchangeEvaluated, 1);
+            
+            if (delta < 0) {
+                EC_COUNT(improvingFound, 1);
+                // We store u (node to remove) and v (node to add)
+                // We don't need v_next for Type 2
+                LM.push_back({2, delta, u, -1, v, -1}); 
+            }
+        }
+    };
+
+    // Or-opt: the segment of len nodes starting at seg_idx against the insertion edge starting at c_idx, both orientations
+    auto addOrOptMove = [&](int seg_idx, int len, int c_idx) {
+        if ((c_idx - seg_idx + n) % n < len || (c_idx + 1 - seg_idx + n) % n < len) return;
+        int p = solution[(seg_idx - 1 + n) % n];
+        int sf = solution[seg_idx];
+        int sl = solution[(seg_idx + len - 1) % n];
+        int q = solution[(seg_idx + len) % n];
+        int c = solution[c_idx];
+        int d = solution[(c_idx + 1) % n];
+        if (c == p) return; // back into its own gap
+        for (int r = 0; r < (len == 1 ? 1 : 2); ++r) {
+            int delta = orOptDelta(distanceMatrix, p, sf, sl, q, c, d, r == 1);
+            EC_COUNT(intraEvaluated, 1);
+            if (delta < 0) {
+                EC_COUNT(improvingFound, 1);
+                LM.push_back({3, delta, p, sf, sl, q, c, d, r == 1});
+            }
+        }
+    };
+
+    auto addOrOptSegment = [&](int seg_idx, int len) {
+        if (len + 3 > n) return;
+        seg_idx = (seg_idx % n + n) % n;
+        for (int c_idx = 0; c_idx < n; ++c_idx) addOrOptMove(seg_idx, len, c_idx);
+    };
+
+    auto addOrOptEdge = [&](int c_idx) {
+        c_idx = (c_idx % n + n) % n;
+        for (int len = 1; len <= MAX_OR_OPT_LENGTH && len + 3 <= n; ++len)
+            for (int seg_idx = 0; seg_idx < n; ++seg_idx) addOrOptMove(seg_idx, len, c_idx);
+    };
+
+    if (fullScan) {
+        if (orOpt)
+            for (int len = 1; len <= MAX_OR_OPT_LENGTH; ++len)
+                for (int i = 0; i < n; ++i) addOrOptSegment(i, len);
+
+        if (neighbourLists) {
+            // An improving move is met from one to four of its ends; only the first of them (in the order
+            // u, v on the successor side, u_next, v_next on the predecessor side) whose bound admits it adds it
+            const int anyGain = 0;
+            for (int i = 0; i < n; ++i) {
+                for (int side : {1, -1}) {
+                    scanTwoOptAround(*neighbourLists, distanceMatrix, solution, pos, i, side, anyGain, [&](int a, int b) {
+                        int u = solution[(a - 1 + n) % n], u_next = solution[a];
+                        int v = solution[b], v_next = solution[(b + 1) % n];
+                        int delta = (dist(u, v) + dist(u_next, v_next)) - (dist(u, u_next) + dist(v, v_next));
+                        EC_COUNT(intraEvaluated, 1);
+                        if (delta >= 0) return false;
+
+                        int first = dist(u, v) < dist(u, u_next) ? 0
+                                  : dist(v, u) < dist(v, v_next) ? 1
+                                  : dist(u_next, v_next) < dist(u_next, u) ? 2 : 3;
+                        int view = side == 1 ? (solution[i] == u ? 0 : 1) : (solution[i] == u_next ? 2 : 3);
+                        if (first == view) {
+                            EC_COUNT(improvingFound, 1);
+                            LM.push_back({1, delta, u, u_next, v, v_next});
+                        }
+                        return false;
+                    });
+                }
+            }
+        }
+        // Scan all current edges for 2-opt
+        for (int i = 0; i < n && !neighbourLists; ++i) {
+            // Optimization: 2-opt is symmetric, only check j > i essentially
+            // But for simplicity of loop structure above, we can loop all.
+            // Better:
+            for (int j = i + 2; j < n + (i > 0 ? 0 : -1); ++j) {
+                 int u = solution[i];
+                 int u_next = solution[(i+1)%n];
+                 int v = solution[j];
+                 int v_next = solution[(j+1)%n];
+                 int delta = (dist(u, v) + dist(u_next, v_next)) - (dist(u, u_next) + dist(v, v_next));
+                 EC_COUNT(intraEvaluated, 1);
+                 EC_COUNT(improvingFound, delta < 0);
+                 if(delta < 0) LM.push_back({1, delta, u, u_next, v, v_next});
+            }
+        }
+        // Scan all nodes for Inter-Exchange
+        for (int i = 0; i < n; ++i) {
+            addInterMoves(i);
+        }
+    } 
+    else {
+        // Incremental update
+        // We only check moves involving 'nodesToCheck'
+        for (int node : nodesToCheck) {
+            int idx = pos[node];
+            if (idx != -1) {
+                // Node is in solution: Check 2-opt starting here, and Swaps removing this
+                addInterMoves(idx); 
+                if (orOpt) {
+                    // Segments starting, ending or bordering here, and insertions into both edges of the node
+                    for (int len = 1; len <= MAX_OR_OPT_LENGTH; ++len) {
+                        addOrOptSegment(idx, len);
+                        if (len > 1) addOrOptSegment(idx - len + 1, len);
+                        addOrOptSegment(idx + 1, len);
+                        addOrOptSegment(idx - len, len);
+                    }
+                    addOrOptEdge(idx - 1);
+                    addOrOptEdge(idx);
+                }
+                // For 2-opt, we should strictly check all edges, but checking edges connected to 'node' is sufficient approximation
+                // We check edges (node, node_next) and (node_prev, node) against all others
+                // This is expensive to do perfectly incrementally, so we scan the whole tour against this node's edges
+                int u = node;
+                int u_next = solution[(idx + 1) % n];
+                // ... (Simplified: re-scanning full 2-opt is too slow, scanning just this node against all others is O(N))
+                for(int j=0; j<n; ++j) {
+                     if(std::abs(idx - j) <= 1 || (idx==0 && j==n-1) || (idx==n-1 && j==0)) continue;
+                     int v = solution[j];
+                     int v_next = solution[(j+1)%n];
+                     int delta = (dist(u, v) + dist(u_next, v_next)) - (dist(u, u_next) + dist(v, v_next));
+                     EC_COUNT(intraEvaluated, 1);
+                     EC_COUNT(improvingFound, delta < 0);
+                     if(delta < 0) LM.push_back({1, delta, u, u_next, v, v_next});
+                }
+            }
+            else {
+                // Node is NOT in solution: It can only be a candidate for Swap (v)
+                // Check this 'node' against all 'u' in solution
+                for (int i = 0; i < n; ++i) {
+                     int u = solution[i];
+                     int u_prev = solution[(i - 1 + n) % n];
+                     int u_next_node = solution[(i + 1) % n];
+                     if (exchangeOrder && n > 1 && exchangeOrder->bound(node) >= dist(u_prev, u) + dist(u, u_next_node) + cost(u)) {
+                         EC_COUNT(exchangeSkipped, 1);
+                         continue;
+                     }
+                     int delta = (dist(u_prev, node) + dist(node, u_next_node) + cost(node)) 
+                               - (dist(u_prev, u) + dist(u, u_next_node) + cost(u));
+                     EC_COUNT(exchangeEvaluated, 1);
+                     EC_COUNT(improvingFound, delta < 0);
+                     if(delta < 0) LM.push_back({2, delta, u, -1, node, -1});
+                }
+            }
+        }
+    }
+}
+
+void addMovesAround(
+    int **distanceMatrix,
+    const std::vector<int> &costVector,
+    const std::vector<int> &solution,
+    const std::vector<int> &pos,
+    std::vector<Move> &LM,
+    int size,
+    const std::vector<int> &changed,
+    bool orOpt,
+    const ExchangeOrder *exchangeOrder)
+{
+    std::vector<Move> newMoves;
+    generateMoves(distanceMatrix, costVector, solution, pos, newMoves, false, size, changed, orOpt, nullptr, exchangeOrder);
+    std::sort(newMoves.begin(), newMoves.end(), compareMoves);
+    size_t oldSize = LM.size();
+    LM.insert(LM.end(), newMoves.begin(), newMoves.end());
+    std::inplace_merge(LM.begin(), LM.begin() + oldSize, LM.end(), compareMoves);
+    EC_COUNT_MAX(moveListHighWater, LM.size());
+}
+
+void runMoveListSearch(
+    int **distanceMatrix,
+    const std::vector<int> &costVector,
+    int size,
+    std::vector<int> &solution,
+    std::vector<int> &pos,
+    std::vector<Move> &LM,
+    bool orOpt,
+    const ExchangeOrder *exchangeOrder)
+{
+    int n = static_cast<int>(solution.size());
+    bool localOptimum = false;
+
+    Deadline &deadline = Deadline::current();
+    // An iteration regenerates O(n) moves and merges them into the list, so both count as work
+    while (!localOptimum && !LM.empty() && !deadline.expired(n + static_cast<long>(LM.size())))
+    {
+        bool moveApplied = false;
+        std::vector<int> changed;
+        EC_COUNT(iterations, 1);
+
+        // Dropped moves are compacted out in one pass instead of erased one by one; the order is kept
+        size_t keep = 0, next = 0;
+        for (; next < LM.size(); ++next)
+        {
+            Move m = LM[next];
+            
+            if (m.type == 1) { // Intra-Route (2-opt)
+                int e1 = checkEdge(m.u, m.u_next, solution, pos);
+                int e2 = checkEdge(m.v, m.v_next, solution, pos);
+
+                if (e1 == 0 || e2 == 0) { EC_COUNT(checkEdgeRejections, 1); continue; } // Edge broken
+                if (e1 != e2) { LM[keep++] = m; continue; } // Direction mismatch (skip)
+
+                // Apply 2-opt
+                moveApplied = true;
+                EC_COUNT(movesApplied, 1);
+                int p1, p2;
+                if (e1 == 1) { p1 = pos[m.u_next]; p2 = pos[m.v]; }
+                else { p1 = pos[m.u]; p2 = pos[m.v_next]; } // Inverted case
+
+                reverseCircularSegment(solution, p1, p2);
+                
+                // Update Pos
+                for(int k=0; k<n; ++k) pos[solution[k]] = k;
+                
+                changed = {m.u, m.u_next, m.v, m.v_next};
+                break;
+            }
+            else if (m.type == 3) { // Or-opt (Segment Relocation)
+                // Edges (u, u_next), (v, v_next) around the segment and (w, w_next) must exist in one common direction
+                int e1 = checkEdge(m.u, m.u_next, solution, pos);
+                int e2 = checkEdge(m.v, m.v_next, solution, pos);
+                int e3 = checkEdge(m.w, m.w_next, solution, pos);
+
+                if (e1 == 0 || e2 == 0 || e3 == 0) { EC_COUNT(checkEdgeRejections, 1); continue; }
+                if (e1 != e2 || e1 != e3) { LM[keep++] = m; continue; }
+
+                // Its ends are unchanged, so the delta is too, but the segment between them may have grown over w
+                int first = (e1 == 1) ? pos[m.u_next] : pos[m.v];
+                int len = (pos[e1 == 1 ? m.v : m.u_next] - first + n) % n + 1;
+                auto inSegment = [&](int node) { return (pos[node] - first + n) % n < len; };
+                if (len > MAX_OR_OPT_LENGTH || inSegment(m.w) || inSegment(m.w_next)) { continue; }
+
+                moveApplied = true;
+                EC_COUNT(movesApplied, 1);
+                // Walking the tour backwards, the segment starts at v and goes after w_next
+                relocateSegment(solution, first, len, e1 == 1 ? m.w : m.w_next, m.reversed);
+                for (int k = 0; k < n; ++k) pos[solution[k]] = k;
+
+                changed = {m.u, m.u_next, m.v, m.v_next, m.w, m.w_next};
+                break;
+            }
+            else if (m.type == 2) { // Inter-Route (Node Replacement)
+                // m.u is node to remove (must be IN solution)
+                // m.v is node to add (must be OUT of solution)
+                
+                int u_idx = pos[m.u];
+                int v_idx = pos[m.v];
+
+                // Validity Check
+                if (u_idx == -1) { continue; } // u no longer in solution
+                if (v_idx != -1) { continue; } // v already in solution
+
+                // Lazy Delta Check (neighbors might have changed)
+                int u_prev = solution[(u_idx - 1 + n) % n];
+                int u_next = solution[(u_idx + 1) % n];
+                
+                int current_delta = (dist(u_prev, m.v) + dist(m.v, u_next) + cost(m.v)) 
+                                  - (dist(u_prev, m.u) + dist(m.u, u_next) + cost(m.u));
+                
+                if (current_delta >= 0) {
+                    EC_COUNT(staleReevaluations, 1);
+                    continue; // No longer improving
+                }
+
+                // Apply Move
+                moveApplied = true;
+                EC_COUNT(movesApplied, 1);
+                solution[u_idx] = m.v; // Replace u with v
+                pos[m.u] = -1;         // u is now out
+                pos[m.v] = u_idx;      // v is now in
+
+                // Nodes changed: The new node v, and its neighbors (previously u's neighbors)
+                // And the removed node u (now available for insertion elsewhere)
+                changed = {m.v, u_prev, u_next, m.u};
+                break;
+            }
+        }
+        // Everything before the applied move that was not kept goes, as does the applied move itself
+        LM.erase(LM.begin() + keep, LM.begin() + std::min(next + 1, LM.size()));
+
+        if (moveApplied) addMovesAround(distanceMatrix, costVector, solution, pos, LM, size, changed, orOpt, exchangeOrder); // Generate new moves
+        else localOptimum = true;
+    }
+}
+
+MultiStartResult M_Steepest_LM_RandomStart(
+    int **distanceMatrix,
+    const std::vector<int> &costVector,
+    int size,
+    int totalRuns,
+    const MultiStartOptions &options,
+    bool orOpt,
+    bool prune)
+{
+    if (size <= 0) return MultiStartResult();
+
+    std::shared_ptr<const NeighbourLists> neighbourLists = prune ? InstanceCache::shared().neighbourLists(distanceMatrix, costVector, size) : nullptr;
+    std::shared_ptr<const ExchangeOrder> exchangeOrder = InstanceCache::shared().exchangeOrder(distanceMatrix, costVector, size);
+
+    MultiStartResult result = runMultiStart(totalRuns, [&](int run, RunRng &g) -> RunResult
+    {
+        std::vector<int> solution = randomPermutation(size, g);
+        int n = static_cast<int>(solution.size());
+        
+        std::vector<int> pos(size, -1);
+        for(int i=0; i<n; ++i) pos[solution[i]] = i;
+
+        std::vector<Move> LM;
+        LM.reserve(n * n); 
+        generateMoves(distanceMatrix, costVector, solution, pos, LM, true, size, {}, orOpt, neighbourLists.get(), exchangeOrder.get());
+        std::sort(LM.begin(), LM.end(), compareMoves);
+        EC_COUNT_MAX(moveListHighWater, LM.size());
+
+        runMoveListSearch(distanceMatrix, costVector, size, solution, pos, LM, orOpt, exchangeOrder.get());
+
+        int finalCost = evaluateSolution(solution, distanceMatrix, costVector);
+        return {finalCost, solution};
+    }, options);
+
+    return result;
+}
+#undef dist
+#undef cost
@@ -0,0 +1,140 @@
+#ifndef LOCAL_SEARCH_H
+#define LOCAL_SEARCH_H
+
+#include <vector>
+
+#include "multiStartRunner.h"
+#include "neighbourLists.h"
+#include "exchangeOrder.h"
+#include "scanTeam.h"
+
+// ==================== ASSIGNMENT 3: STEEPEST / GREEDY LOCAL SEARCH ====================
+// See the METHODS OVERVIEW in localSearch.cpp for what distinguishes M1-M8.
+// With prune, the 2-opt methods scan distance-sorted neighbour lists and stop each scan at the first
+// neighbour that cannot gain (TwoEdgeExchangePruned in localSearchCore.h).
+
+MultiStartResult M1_steepestDescent_TwoNodeExchange_RandomStart(int **distanceMatrix, const std::vector<int> &costVector, int size, int totalRuns = 200,
+    const MultiStartOptions &options = MultiStartOptions::fromEnvironment());
+MultiStartResult M2_steepestDescent_TwoNodeExchange_GreedyStart(int **distanceMatrix, const std::vector<int> &costVector, int size, int totalRuns = 200,
+    const MultiStartOptions &options = MultiStartOptions::fromEnvironment());
+MultiStartResult M3_steepestDescent_TwoEdgeExchange_RandomStart(int **distanceMatrix, const std::vector<int> &costVector, int size, int totalRuns = 200,
+    const MultiStartOptions &options = MultiStartOptions::fromEnvironment(), bool prune = false);
+MultiStartResult M4_steepestDescent_TwoEdgeExchange_GreedyStart(int **distanceMatrix, const std::vector<int> &costVector, int size, int totalRuns = 200,
+    const MultiStartOptions &options = MultiStartOptions::fromEnvironment(), bool prune = false);
+MultiStartResult M5_greedyFirstImprovement_TwoNodeExchange_RandomStart(int **distanceMatrix, const std::vector<int> &costVector, int size, int totalRuns = 200,
+    const MultiStartOptions &options = MultiStartOptions::fromEnvironment());
+MultiStartResult M6_greedyFirstImprovement_TwoNodeExchange_GreedyStart(int **distanceMatrix, const std::vector<int> &costVector, int size, int totalRuns = 200,
+    const MultiStartOptions &options = MultiStartOptions::fromEnvironment());
+MultiStartResult M7_greedyFirstImprovement_TwoEdgeExchange_RandomStart(int **distanceMatrix, const std::vector<int> &costVector, int size, int totalRuns = 200,
+    const MultiStartOptions &options = MultiStartOptions::fromEnvironment(), bool prune = false);
+MultiStartResult M8_greedyFirstImprovement_TwoEdgeExchange_GreedyStart(int **distanceMatrix, const std::vector<int> &costVector, int size, int totalRuns = 200,
+    const MultiStartOptions &options = MultiStartOptions::fromEnvironment(), bool prune = false);
+
+// ==================== ASSIGNMENT 4: CANDIDATE MOVES ====================
+
+std::vector<std::vector<int>> createCandidateList(int **distanceMatrix, const std::vector<int> &costVector, int size, int K = 10);
+// createCandidateList without the CandidateListCache
+std::vector<std::vector<int>> buildCandidateList(int **distanceMatrix, const std::vector<int> &costVector, int size, int K = 10);
+// Brings lists built with K up to date after the costs of `changed` and the positions of `moved` (a subset) changed
+void updateCandidateList(int **distanceMatrix, const std::vector<int> &costVector, int size, int K,
+                         std::vector<std::vector<int>> &candidateList, const std::vector<int> &changed, const std::vector<int> &moved = {});
+
+// Or-opt segments relocate 1..MAX_OR_OPT_LENGTH consecutive nodes
+const int MAX_OR_OPT_LENGTH = 3;
+
+// Steepest descent over candidate moves from the given tour; returns the objective of the local optimum.
+// With orOpt, segments ending in a candidate v of u are also relocated next to u (creating the edge (u, v)).
+// With or3Opt, segments of any length move without reversal (a pure 3-opt reconnection) when both new edges
+// that border the moved segment's old place come from candidate lists, pruned by the partial gain.
+// With a team, each iteration's scan is split over its parts by position; the moves taken stay the same.
+int runCandidateListSearch(
+    int **distanceMatrix,
+    const std::vector<int> &costVector,
+    const std::vector<std::vector<int>>& candidateList,
+    int size,
+    std::vector<int> &solution,
+    int currentCost,
+    bool orOpt = false,
+    bool or3Opt = false,
+    ScanTeam *team = nullptr);
+
+MultiStartResult M_Steepest_CandidateList_RandomStart(
+    int **distanceMatrix,
+    const std::vector<int> &costVector,
+    const std::vector<std::vector<int>>& candidateList,
+    int size,
+    int totalRuns = 200,
+    const MultiStartOptions &options = MultiStartOptions::fromEnvironment(),
+    bool orOpt = false,
+    bool or3Opt = false);
+
+// ==================== ASSIGNMENT 5: LM & LAZY EVAL LOGIC ====================
+
+struct Move {
+    int type; // 1 = Intra (2-opt), 2 = Inter (Swap In-Node with Out-Node), 3 = Or-opt (segment relocation)
+    int delta;
+    
+    // For Intra (2-opt): edges (u, u_next) and (v, v_next) are broken.
+    // For Inter (Swap): node u (IN) is replaced by node v (OUT).
+    // For Or-opt: the segment u_next..v between u and v_next moves between w and w_next.
+    int u, u_next; // Used for Type 1 & Type 2 (u is the node being removed)
+    int v, v_next; // Used for Type 1. For Type 2, v is the *replacement* node.
+    int w = -1, w_next = -1; // Used for Type 3
+    bool reversed = false;   // Type 3: inserted as w, v..u_next, w_next
+};
+
+bool compareMoves(const Move &a, const Move &b);
+
+// Returns: 1 (Forward), -1 (Reversed), 0 (Broken/Non-existent)
+int checkEdge(int u, int v, const std::vector<int>& sol, const std::vector<int>& pos);
+
+// With neighbourLists, the 2-opt part of a full scan only walks the neighbours that can gain (scanTwoOptAround);
+// with exchangeOrder, the in/out exchanges stop at the first unselected node whose bound rules it out. Either
+// way the same improving moves are found; exchangeOrder also keeps their order in LM
+void generateMoves(
+    int **distanceMatrix,
+    const std::vector<int> &costVector,
+    const std::vector<int> &solution,
+    const std::vector<int> &pos,
+    std::vector<Move> &LM,
+    bool fullScan,
+    int totalNodes,
+    const std::vector<int> &nodesToCheck = {},
+    bool orOpt = false,
+    const NeighbourLists *neighbourLists = nullptr,
+    const ExchangeOrder *exchangeOrder = nullptr);
+
+// Sorts moves generated around the changed nodes and merges them into the sorted move list
+void addMovesAround(
+    int **distanceMatrix,
+    const std::vector<int> &costVector,
+    const std::vector<int> &solution,
+    const std::vector<int> &pos,
+    std::vector<Move> &LM,
+    int size,
+    const std::vector<int> &changed,
+    bool orOpt = false,
+    const ExchangeOrder *exchangeOrder = nullptr);
+
+// Applies moves from the sorted move list until none applies; solution, pos and LM stay consistent,
+// so a caller may perturb the tour, add the moves around the change and call it again
+void runMoveListSearch(
+    int **distanceMatrix,
+    const std::vector<int> &costVector,
+    int size,
+    std::vector<int> &solution,
+    std::vector<int> &pos,
+    std::vector<Move> &LM,
+    bool orOpt = false,
+    const ExchangeOrder *exchangeOrder = nullptr);
+
+MultiStartResult M_Steepest_LM_RandomStart(
+    int **distanceMatrix,
+    const std::vector<int> &costVector,
+    int size,
+    int totalRuns = 200,
+    const MultiStartOptions &options = MultiStartOptions::fromEnvironment(),
+    bool orOpt = false,
+    bool prune = false);
+
+#endif
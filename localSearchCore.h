@@ -0,0 +1,487 @@
+#ifndef LOCAL_SEARCH_CORE_H
+#define LOCAL_SEARCH_CORE_H
+
+#include <vector>
+#include <string>
+#include <numeric>
+#include <random>
+#include <cstdint>
+#include <climits>
+#include <memory>
+#include <algorithm>
+#include <tuple>
+
+#include "multiStartRunner.h"
+#include "constructors.h"
+#include "constructionCache.h"
+#include "tourUtils.h"
+#include "deadline.h"
+#include "tourHash.h"
+#include "solutionPool.h"
+#include "neighbourLists.h"
+#include "exchangeOrder.h"
+#include "scanTeam.h"
+#include "instanceCache.h"
+
+/**
+ * @brief Policy-based local search behind M1-M8.
+ *
+ *   LocalSearch<Neighbourhood, Acceptance, Start>
+ *
+ * Neighbourhood: intra-route move between two tour positions (TwoNodeExchange, TwoEdgeExchange,
+ *                TwoEdgeExchangePruned). Every neighbourhood is combined with the inter-route
+ *                exchange of a selected node for an unselected one.
+ * Acceptance:    SteepestDescent or FirstImprovement, which owns the scan order. On large
+ *                instances SteepestDescent splits its scan over a ScanTeam (scanTeamSize).
+ * Start:         RandomStart or GreedyStart (greedy insertion from a random start node).
+ *
+ * All policies are static and resolved at compile time, so the delta functions
+ * inline into the scan loops and no move type is branched on per candidate.
+ * Moves are scored by O(1) deltas on the cyclic tour instead of re-evaluating
+ * the whole solution; the scan order and tie-breaking are those of the original
+ * M1-M8, so the same seed still yields the same tours. The exchange scans
+ * walk the unselected nodes in ExchangeOrder and stop (or skip) where its
+ * bound rules every remaining node out; ties still go to the lowest node id.
+ * In the anytime mode an expired Deadline::current() ends the search with the
+ * current (valid) solution.
+ * Applied moves also update the TourHash of the tour, so a run stops as soon
+ * as it stands on a local optimum an earlier run of the same neighbourhood
+ * and acceptance already reached (KnownOptima); the result is the same as
+ * without the check, only the last full scan is saved.
+ */
+
+// Objective change of replacing the node at position i by the unselected newNode
+inline int exchangeDelta(int **distanceMatrix, const std::vector<int> &costVector, const std::vector<int> &solution, int i, int newNode) {
+    int n = static_cast<int>(solution.size());
+    int oldNode = solution[i];
+    int costDelta = costVector[newNode] - costVector[oldNode];
+    if (n == 1) return costDelta;
+
+    int prev = solution[(i - 1 + n) % n];
+    int next = solution[(i + 1) % n];
+    return costDelta + distanceMatrix[prev][newNode] + distanceMatrix[newNode][next]
+                     - distanceMatrix[prev][oldNode] - distanceMatrix[oldNode][next];
+}
+
+// Replaces the node at position i by newNode and updates the tour hash
+inline void applyExchange(std::vector<int> &solution, std::vector<char> &used, TourHash &hash, int i, int newNode) {
+    int n = static_cast<int>(solution.size());
+    int oldNode = solution[i];
+    hash.toggleNode(oldNode);
+    hash.toggleNode(newNode);
+    if (n > 1) {
+        int prev = solution[(i - 1 + n) % n];
+        int next = solution[(i + 1) % n];
+        hash.toggleEdge(prev, oldNode);
+        hash.toggleEdge(oldNode, next);
+        hash.toggleEdge(prev, newNode);
+        hash.toggleEdge(newNode, next);
+    }
+    used[oldNode] = 0;
+    used[newNode] = 1;
+    solution[i] = newNode;
+}
+
+struct TwoNodeExchange {
+    static constexpr const char *name = "TwoNodeExchange";
+    static constexpr bool usesNeighbourLists = false;
+
+    // Swap the nodes at positions i and j
+    static int delta(int **distanceMatrix, const std::vector<int> &solution, int i, int j) {
+        int n = static_cast<int>(solution.size());
+        int a = solution[i], b = solution[j];
+        int prevA = solution[(i - 1 + n) % n], nextA = solution[(i + 1) % n];
+        int prevB = solution[(j - 1 + n) % n], nextB = solution[(j + 1) % n];
+
+        if (nextA != b && nextB != a) {
+            return distanceMatrix[prevA][b] + distanceMatrix[b][nextA] + distanceMatrix[prevB][a] + distanceMatrix[a][nextB]
+                 - distanceMatrix[prevA][a] - distanceMatrix[a][nextA] - distanceMatrix[prevB][b] - distanceMatrix[b][nextB];
+        }
+
+        // Adjacent positions share edges: sum the distinct edges around both positions before and after
+        auto at = [&](int p) { return p == i ? b : (p == j ? a : solution[p]); };
+        int starts[4] = {(i - 1 + n) % n, i, (j - 1 + n) % n, j};
+        int delta = 0;
+        for (int k = 0; k < 4; ++k) {
+            bool seen = false;
+            for (int m = 0; m < k; ++m) seen = seen || starts[m] == starts[k];
+            if (seen) continue;
+            int p = starts[k], q = (p + 1) % n;
+            delta += distanceMatrix[at(p)][at(q)] - distanceMatrix[solution[p]][solution[q]];
+        }
+        return delta;
+    }
+
+    static void apply(std::vector<int> &solution, TourHash &hash, int i, int j) {
+        int n = static_cast<int>(solution.size());
+        int starts[4] = {(i - 1 + n) % n, i, (j - 1 + n) % n, j};
+        auto toggleEdges = [&]() {
+            for (int k = 0; k < 4; ++k) {
+                bool seen = false;
+                for (int m = 0; m < k; ++m) seen = seen || starts[m] == starts[k];
+                if (!seen) hash.toggleEdge(solution[starts[k]], solution[(starts[k] + 1) % n]);
+            }
+        };
+        toggleEdges();
+        std::swap(solution[i], solution[j]);
+        toggleEdges();
+    }
+};
+
+struct TwoEdgeExchange {
+    static constexpr const char *name = "TwoEdgeExchange";
+    static constexpr bool usesNeighbourLists = false;
+
+    // Reverse the tour segment between positions i and j (in either order); assumes a symmetric matrix
+    static int delta(int **distanceMatrix, const std::vector<int> &solution, int i, int j) {
+        int n = static_cast<int>(solution.size());
+        int a = std::min(i, j), b = std::max(i, j);
+        if (a == 0 && b == n - 1) return 0;
+
+        int prev = solution[(a - 1 + n) % n];
+        int next = solution[(b + 1) % n];
+        return distanceMatrix[prev][solution[b]] + distanceMatrix[solution[a]][next]
+             - distanceMatrix[prev][solution[a]] - distanceMatrix[solution[b]][next];
+    }
+
+    // The reversed segment keeps its undirected edges, so only the two reconnected ones change the hash
+    static void apply(std::vector<int> &solution, TourHash &hash, int i, int j) {
+        int n = static_cast<int>(solution.size());
+        int a = std::min(i, j), b = std::max(i, j);
+        if (!(a == 0 && b == n - 1)) {
+            int prev = solution[(a - 1 + n) % n];
+            int next = solution[(b + 1) % n];
+            hash.toggleEdge(prev, solution[a]);
+            hash.toggleEdge(solution[b], next);
+            hash.toggleEdge(prev, solution[b]);
+            hash.toggleEdge(solution[a], next);
+        }
+        std::reverse(solution.begin() + a, solution.begin() + b + 1);
+    }
+};
+
+// 2-opt scanned from distance-sorted neighbour lists (scanTwoOptAround): the scan of a tour position
+// stops at the first neighbour that cannot gain. Same moves and deltas as TwoEdgeExchange; steepest descent
+// breaks ties as the full scan does, but first improvement meets the moves in another order than M7/M8.
+struct TwoEdgeExchangePruned : TwoEdgeExchange {
+    static constexpr const char *name = "TwoEdgeExchangePruned";
+    static constexpr bool usesNeighbourLists = true;
+};
+
+struct SteepestDescent {
+    static constexpr bool deterministic = true;
+    static constexpr bool parallelScan = true;
+    static constexpr const char *name = "SteepestDescent";
+
+    struct ScanBest {
+        int delta = 0;
+        bool isExchange = false;
+        int i = -1, j = -1;
+    };
+
+    // Applies the best improving move; returns false at a local optimum. With a team, every part scans a range
+    // of positions for both move types and the per-part bests are reduced by the order the serial scan keeps
+    template <typename Neighbourhood>
+    static bool improve(int **distanceMatrix, const std::vector<int> &costVector, int size, const NeighbourLists &lists,
+                        const ExchangeOrder &exchangeOrder, ScanTeam *team, std::vector<int> &solution, std::vector<char> &used,
+                        TourHash &hash, int &currentCost, RunRng &) {
+        int solSize = static_cast<int>(solution.size());
+        EC_COUNT(iterations, 1);
+
+        // A reference, so that the parts read this thread's positions
+        thread_local std::vector<int> positions;
+        std::vector<int> &pos = positions;
+        if constexpr (Neighbourhood::usesNeighbourLists) {
+            pos.assign(size, -1);
+            for (int i = 0; i < solSize; ++i) pos[solution[i]] = i;
+        }
+
+        // Intra moves from positions [intraBegin, intraEnd), then exchanges at [exchangeBegin, exchangeEnd); an
+        // equal delta keeps the lowest (i, j), and the lowest node id at the same position for exchanges. Returns
+        // false if the deadline cut the scan short
+        auto scan = [&](int intraBegin, int intraEnd, int exchangeBegin, int exchangeEnd, ScanBest &best) {
+            Deadline &deadline = Deadline::current();
+            int bestGain = 0; // the pruned scan visits moves gaining at least this much more than half of it
+
+            auto consider = [&](int i, int j) {
+                int delta = Neighbourhood::delta(distanceMatrix, solution, i, j);
+                EC_COUNT(improvingFound, delta < 0);
+                if (delta < best.delta || (delta == best.delta && best.delta < 0 && !best.isExchange &&
+                                           std::make_pair(i, j) < std::make_pair(best.i, best.j))) {
+                    best = {delta, false, i, j};
+                    bestGain = -delta - 1;
+                }
+                return false;
+            };
+
+            if constexpr (Neighbourhood::usesNeighbourLists) {
+                for (int i = intraBegin; i < intraEnd; ++i) {
+                    if (deadline.expired(solSize - i)) return false;
+                    for (int side : {1, -1})
+                        scanTwoOptAround(lists, distanceMatrix, solution, pos, i, side, bestGain, [&](int a, int b) {
+                            EC_COUNT(intraEvaluated, 1);
+                            // Reversing a..last is reversing 0..a-1; the full scan meets it as the latter first
+                            return b == solSize - 1 && a > 1 ? consider(0, a - 1) : consider(a, b);
+                        });
+                }
+            } else {
+                for (int i = intraBegin; i < std::min(intraEnd, solSize - 1); ++i) {
+                    if (deadline.expired(solSize - i)) return false;
+                    EC_COUNT(intraEvaluated, solSize - 1 - i);
+                    for (int j = i + 1; j < solSize; ++j)
+                        consider(i, j);
+                }
+            }
+
+            // Nodes come by bound, so an equal delta at the same position goes to the lower id, as in id order
+            const std::vector<int> &byBound = exchangeOrder.nodes();
+            for (int i = exchangeBegin; i < exchangeEnd; ++i) {
+                if (deadline.expired(size - solSize)) return false;
+                int share = exchangeShare(distanceMatrix, costVector, solution, i);
+                for (auto it = byBound.begin(); it != byBound.end(); ++it) {
+                    int newNode = *it;
+                    if (solSize > 1 && exchangeOrder.bound(newNode) - share > best.delta) {
+                        EC_COUNT(exchangeSkipped, byBound.end() - it);
+                        break;
+                    }
+                    if (used[newNode]) continue;
+                    int delta = exchangeDelta(distanceMatrix, costVector, solution, i, newNode);
+                    EC_COUNT(exchangeEvaluated, 1);
+                    EC_COUNT(improvingFound, delta < 0);
+                    if (delta < best.delta || (delta == best.delta && best.isExchange && best.i == i && newNode < best.j)) {
+                        best = {delta, true, i, newNode};
+                        bestGain = -delta - 1;
+                    }
+                }
+            }
+            return true;
+        };
+
+        ScanBest best;
+        if (!team || team->parts() == 1) {
+            if (!scan(0, solSize, 0, solSize, best)) return false;
+        } else {
+            // Unpruned rows shrink with i, so the intra parts are cut at equal pair counts
+            auto rowsFrom = [&](int part) {
+                long long target = static_cast<long long>(solSize) * (solSize - 1) / 2 * part / team->parts();
+                long long before = 0;
+                int i = 0;
+                for (; i < solSize && before < target; ++i) before += solSize - 1 - i;
+                return i;
+            };
+
+            std::vector<ScanBest> partBest(team->parts());
+            std::vector<char> complete(team->parts(), 0);
+            bool reached = team->run([&](int part) {
+                std::pair<int, int> intra = Neighbourhood::usesNeighbourLists ? team->range(part, solSize)
+                                                                              : std::make_pair(rowsFrom(part), rowsFrom(part + 1));
+                std::pair<int, int> exchange = team->range(part, solSize);
+                complete[part] = scan(intra.first, intra.second, exchange.first, exchange.second, partBest[part]);
+            });
+            if (reached || std::find(complete.begin(), complete.end(), 0) != complete.end()) return false;
+
+            // Lowest delta, intra before exchange, then the lowest (i, j): the move the serial scan keeps. Not the
+            // earlier part, as a pruned part also meets pairs outside its own range of positions
+            for (const ScanBest &candidate : partBest)
+                if (candidate.delta < 0 && std::make_tuple(candidate.delta, candidate.isExchange, candidate.i, candidate.j) <
+                                           std::make_tuple(best.delta, best.isExchange, best.i, best.j))
+                    best = candidate;
+        }
+
+        if (best.delta >= 0) return false;
+
+        EC_COUNT(movesApplied, 1);
+        if (best.isExchange)
+            applyExchange(solution, used, hash, best.i, best.j);
+        else
+            Neighbourhood::apply(solution, hash, best.i, best.j);
+        currentCost += best.delta;
+        return true;
+    }
+};
+
+struct FirstImprovement {
+    static constexpr bool deterministic = false;
+    static constexpr bool parallelScan = false;
+    static constexpr const char *name = "FirstImprovement";
+
+    // Browses positions, move types and unselected nodes in random order and applies the first improving move
+    template <typename Neighbourhood>
+    static bool improve(int **distanceMatrix, const std::vector<int> &costVector, int size, const NeighbourLists &lists,
+                        const ExchangeOrder &exchangeOrder, ScanTeam *, std::vector<int> &solution, std::vector<char> &used,
+                        TourHash &hash, int &currentCost, RunRng &g) {
+        int solSize = static_cast<int>(solution.size());
+        EC_COUNT(iterations, 1);
+        Deadline &deadline = Deadline::current();
+
+        std::vector<int> order(solSize);
+        std::iota(order.begin(), order.end(), 0);
+        std::shuffle(order.begin(), order.end(), g);
+
+        std::vector<int> moveTypes = {0, 1};
+        std::shuffle(moveTypes.begin(), moveTypes.end(), g);
+
+        for (int moveType : moveTypes) {
+            if (moveType == 0 && Neighbourhood::usesNeighbourLists) {
+                // Random tour positions, each with its successor side first
+                thread_local std::vector<int> pos;
+                pos.assign(size, -1);
+                for (int i = 0; i < solSize; ++i) pos[solution[i]] = i;
+                int moveDelta = 0, anyGain = 0;
+                for (int oi = 0; oi < solSize; ++oi) {
+                    if (deadline.expired(solSize - oi)) return false;
+                    for (int side : {1, -1}) {
+                        bool found = scanTwoOptAround(lists, distanceMatrix, solution, pos, order[oi], side, anyGain, [&](int a, int b) {
+                            EC_COUNT(intraEvaluated, 1);
+                            moveDelta = Neighbourhood::delta(distanceMatrix, solution, a, b);
+                            if (moveDelta >= 0) return false;
+                            EC_COUNT(improvingFound, 1);
+                            EC_COUNT(movesApplied, 1);
+                            Neighbourhood::apply(solution, hash, a, b);
+                            return true;
+                        });
+                        if (found) {
+                            currentCost += moveDelta;
+                            return true;
+                        }
+                    }
+                }
+            } else if (moveType == 0) {
+                for (int oi = 0; oi < solSize - 1; ++oi) {
+                    if (deadline.expired(solSize - oi)) return false;
+                    for (int oj = oi + 1; oj < solSize; ++oj) {
+                        int delta = Neighbourhood::delta(distanceMatrix, solution, order[oi], order[oj]);
+                        EC_COUNT(intraEvaluated, 1);
+                        if (delta < 0) {
+                            EC_COUNT(improvingFound, 1);
+                            EC_COUNT(movesApplied, 1);
+                            Neighbourhood::apply(solution, hash, order[oi], order[oj]);
+                            currentCost += delta;
+                            return true;
+                        }
+                    }
+                }
+            } else {
+                std::vector<int> notSelected;
+                for (int node = 0; node < size; ++node)
+                    if (!used[node]) notSelected.push_back(node);
+                std::shuffle(notSelected.begin(), notSelected.end(), g);
+
+                // The order stays random; the bound only passes over exchanges that cannot gain
+                int cheapest = INT_MAX;
+                for (int node : exchangeOrder.nodes())
+                    if (!used[node]) {
+                        cheapest = exchangeOrder.bound(node);
+                        break;
+                    }
+
+                for (int oi = 0; oi < solSize; ++oi) {
+                    if (deadline.expired(static_cast<long>(notSelected.size()))) return false;
+                    int selIndex = order[oi];
+                    int share = solSize > 1 ? exchangeShare(distanceMatrix, costVector, solution, selIndex) : INT_MAX;
+                    if (cheapest >= share) {
+                        EC_COUNT(exchangeSkipped, notSelected.size());
+                        continue;
+                    }
+                    for (int newNode : notSelected) {
+                        if (exchangeOrder.bound(newNode) >= share) {
+                            EC_COUNT(exchangeSkipped, 1);
+                            continue;
+                        }
+                        int delta = exchangeDelta(distanceMatrix, costVector, solution, selIndex, newNode);
+                        EC_COUNT(exchangeEvaluated, 1);
+                        if (delta < 0) {
+                            EC_COUNT(improvingFound, 1);
+                            EC_COUNT(movesApplied, 1);
+                            applyExchange(solution, used, hash, selIndex, newNode);
+                            currentCost += delta;
+                            return true;
+                        }
+                    }
+                }
+            }
+        }
+        return false;
+    }
+};
+
+struct RandomStart {
+    static constexpr bool usesStartNode = false;
+
+    static int drawStartNode(int, RunRng &) { return -1; }
+
+    static std::vector<int> build(int **, const std::vector<int> &, int size, int, uint64_t, RunRng &g) {
+        return randomPermutation(size, g);
+    }
+};
+
+struct GreedyStart {
+    static constexpr bool usesStartNode = true;
+
+    static int drawStartNode(int size, RunRng &g) {
+        std::uniform_int_distribution<int> startDist(0, size - 1);
+        return startDist(g);
+    }
+
+    static std::vector<int> build(int **distanceMatrix, const std::vector<int> &costVector, int size, int startNode, uint64_t instanceHash, RunRng &) {
+        return cachedGreedyInsertion(distanceMatrix, costVector, size, startNode, instanceHash);
+    }
+};
+
+template <typename Neighbourhood, typename Acceptance, typename Start>
+struct LocalSearch {
+    /**
+     * @brief Multi-start run of the configured search.
+     * With a deterministic acceptance and a start keyed by the start node, the
+     * local optimum only depends on that node, so it is memoized in the shared
+     * ConstructionCache under optimumTag (if given).
+     */
+    static MultiStartResult run(int **distanceMatrix, const std::vector<int> &costVector, int size, int totalRuns,
+                                const MultiStartOptions &options, const std::string &optimumTag = "") {
+        if (size <= 0) return MultiStartResult();
+
+        constexpr bool memoizable = Acceptance::deterministic && Start::usesStartNode;
+        InstanceCache &instance = InstanceCache::shared();
+        uint64_t instanceHash = instance.hash(distanceMatrix, costVector, size);
+        bool memoize = memoizable && !optimumTag.empty();
+        KnownOptima &knownOptima = KnownOptima::shared(instanceHash, std::string(Neighbourhood::name) + "/" + Acceptance::name);
+        std::shared_ptr<const NeighbourLists> lists = Neighbourhood::usesNeighbourLists ? instance.neighbourLists(distanceMatrix, costVector, size)
+                                                                                        : std::make_shared<const NeighbourLists>();
+        std::shared_ptr<const ExchangeOrder> exchangeOrder = instance.exchangeOrder(distanceMatrix, costVector, size);
+        int scanParts = Acceptance::parallelScan ? scanTeamSize(options, size, totalRuns) : 1;
+
+        return runMultiStart(totalRuns, [&](int, RunRng &g) -> RunResult {
+            int startNode = Start::drawStartNode(size, g);
+
+            std::vector<int> solution;
+            bool cachedOptimum = memoize && ConstructionCache::shared().lookup(instanceHash, optimumTag, startNode, solution);
+            if (!cachedOptimum)
+                solution = Start::build(distanceMatrix, costVector, size, startNode, instanceHash, g);
+            if (solution.empty()) return {0, {}};
+
+            int currentCost = evaluateSolution(solution, distanceMatrix, costVector);
+            if (!cachedOptimum) {
+                std::vector<char> used(size, 0);
+                for (int v : solution) used[v] = 1;
+
+                TourHash hash = TourHash::of(solution);
+                std::unique_ptr<ScanTeam> team = scanParts > 1 ? std::make_unique<ScanTeam>(scanParts) : nullptr;
+                bool known = false;
+                while (!known && Acceptance::template improve<Neighbourhood>(distanceMatrix, costVector, size, *lists, *exchangeOrder, team.get(),
+                                                                             solution, used, hash, currentCost, g))
+                    known = knownOptima.contains(hash.value, currentCost);
+                EC_COUNT(knownOptimumHits, known);
+
+                // A search cut short by the time budget is not a local optimum
+                if (!Deadline::current().reached()) {
+                    if (!known) knownOptima.insert(hash.value, currentCost);
+                    if (memoize) ConstructionCache::shared().store(instanceHash, optimumTag, startNode, solution);
+                }
+            }
+
+            return {currentCost, solution};
+        }, options);
+    }
+};
+
+#endif
@@ -0,0 +1,223 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "methodRegistry.h"
+#include "constructors.h"
+#include "localSearch.h"
+#include "iteratedLocalSearch.h"
+#include "largeNeighbourhoodSearch.h"
+#include "hybridEvolutionary.h"
+#include "islandModel.h"
+#include "linKernighan.h"
+#include "tourPartition.h"
+
+namespace {
+    // Adapts the common (distanceMatrix, costVector, size, runs, options) signature
+    template <typename Method>
+    ExperimentMethod plainMethod(Method method) {
+        return [method](const DataManager& instance, const ExperimentParams&, int runs, const MultiStartOptions& options) {
+            return method(instance.getDistanceMatrix(), instance.getCostVector(), instance.getSize(), runs, options);
+        };
+    }
+
+    // Same, for methods that take one on/off parameter after the options
+    template <typename Method>
+    ExperimentMethod flagMethod(Method method, const std::string& flag) {
+        return [method, flag](const DataManager& instance, const ExperimentParams& params, int runs, const MultiStartOptions& options) {
+            return method(instance.getDistanceMatrix(), instance.getCostVector(), instance.getSize(), runs, options,
+                          getParam(params, flag, 0) != 0);
+        };
+    }
+
+    std::map<std::string, MethodInfo> buildRegistry() {
+        std::map<std::string, MethodInfo> registry;
+
+        registry["random"] = {"Random solution", "constructor", {}, plainMethod(randomSolution)};
+        registry["nearestNeighbourEnd"] = {"Nearest Neighbour solution only adding at the end", "constructor", {},
+                                           plainMethod(nearestNeighbourSolutionOnlyAtEnd)};
+        registry["nearestNeighbourInsertion"] = {"Nearest neighbor (insertion)", "constructor", {},
+                                                 plainMethod(nearestNeighbourSolution)};
+        registry["greedy2Regret"] = {"Greedy 2-Regret Cycle", "constructor", {}, plainMethod(greedy2Regret)};
+        registry["greedyWeightedRegret"] = {"Greedy Weighted (2-Regret + Best Change)", "constructor", {{"alpha", 0.5}},
+            [](const DataManager& instance, const ExperimentParams& params, int runs, const MultiStartOptions& options) {
+                return greedyWeightedRegret(instance.getDistanceMatrix(), instance.getCostVector(), instance.getSize(),
+                                            getParam(params, "alpha", 0.5), runs, options);
+            }};
+
+        registry["M1"] = {"M1 (Steepest Descent, 2-node exchange, random start)", "localSearch", {},
+                          plainMethod(M1_steepestDescent_TwoNodeExchange_RandomStart)};
+        registry["M2"] = {"M2 (Steepest Descent, 2-node exchange, greedy start)", "localSearch", {},
+                          plainMethod(M2_steepestDescent_TwoNodeExchange_GreedyStart)};
+        registry["M3"] = {"M3 (Steepest Descent, 2-edge exchange, random start)", "localSearch", {{"prune", 0}},
+                          flagMethod(M3_steepestDescent_TwoEdgeExchange_RandomStart, "prune")};
+        registry["M4"] = {"M4 (Steepest Descent, 2-edge exchange, greedy start)", "localSearch", {{"prune", 0}},
+                          flagMethod(M4_steepestDescent_TwoEdgeExchange_GreedyStart, "prune")};
+        registry["M5"] = {"M5 (Greedy First-Improvement, 2-node exchange, random start)", "localSearch", {},
+                          plainMethod(M5_greedyFirstImprovement_TwoNodeExchange_RandomStart)};
+        registry["M6"] = {"M6 (Greedy First-Improvement, 2-node exchange, greedy start)", "localSearch", {},
+                          plainMethod(M6_greedyFirstImprovement_TwoNodeExchange_GreedyStart)};
+        registry["M7"] = {"M7 (Greedy First-Improvement, 2-edge exchange, random start)", "localSearch", {{"prune", 0}},
+                          flagMethod(M7_greedyFirstImprovement_TwoEdgeExchange_RandomStart, "prune")};
+        registry["M8"] = {"M8 (Greedy First-Improvement, 2-edge exchange, greedy start)", "localSearch", {{"prune", 0}},
+                          flagMethod(M8_greedyFirstImprovement_TwoEdgeExchange_GreedyStart, "prune")};
+
+        registry["candidateListSteepest"] = {"M_Steepest (Candidate List, 2-opt+Exchange, random start)", "localSearch",
+                                             {{"K", 10}, {"orOpt", 0}, {"or3opt", 0}},
+            [](const DataManager& instance, const ExperimentParams& params, int runs, const MultiStartOptions& options) {
+                int K = static_cast<int>(getParam(params, "K", 10));
+                auto candidateList = createCandidateList(instance.getDistanceMatrix(), instance.getCostVector(), instance.getSize(), K);
+                return M_Steepest_CandidateList_RandomStart(instance.getDistanceMatrix(), instance.getCostVector(), candidateList,
+                                                            instance.getSize(), runs, options, getParam(params, "orOpt", 0) != 0,
+                                                            getParam(params, "or3opt", 0) != 0);
+            }};
+        registry["moveListSteepest"] = {"M_Steepest_LM (Lazy Eval + In/Out Swap)", "localSearch", {{"orOpt", 0}, {"prune", 0}},
+            [](const DataManager& instance, const ExperimentParams& params, int runs, const MultiStartOptions& options) {
+                return M_Steepest_LM_RandomStart(instance.getDistanceMatrix(), instance.getCostVector(), instance.getSize(), runs, options,
+                                                 getParam(params, "orOpt", 0) != 0, getParam(params, "prune", 0) != 0);
+            }};
+
+        registry["lk"] = {"Lin-Kernighan (variable depth, 2-opt/3-opt/exchange steps, random start)", "localSearch",
+                          {{"K", 10}, {"depth", 50}, {"exchanges", 1}},
+            [](const DataManager& instance, const ExperimentParams& params, int runs, const MultiStartOptions& options) {
+                LkParams lk;
+                lk.K = static_cast<int>(getParam(params, "K", 10));
+                lk.maxDepth = static_cast<int>(getParam(params, "depth", 50));
+                lk.exchanges = getParam(params, "exchanges", 1) != 0;
+                return linKernighan(instance.getDistanceMatrix(), instance.getCostVector(), instance.getSize(), lk, runs, options);
+            }};
+        registry["partitionSteepest"] = {"Partitioned candidate-list steepest (parallel tour segments, candidate walk start)", "localSearch",
+                                         {{"K", 10}, {"segment", 1000}, {"rounds", 8}},
+            [](const DataManager& instance, const ExperimentParams& params, int runs, const MultiStartOptions& options) {
+                PartitionParams partition;
+                partition.K = static_cast<int>(getParam(params, "K", 10));
+                partition.segmentLength = static_cast<int>(getParam(params, "segment", 1000));
+                partition.rounds = static_cast<int>(getParam(params, "rounds", 8));
+                return partitionSteepest(instance.getDistanceMatrix(), instance.getCostVector(), instance.getSize(), partition, runs, options);
+            }};
+
+        registry["ils"] = {"ILS (move-list steepest, double-bridge + random exchanges)", "metaheuristic",
+                           {{"iterations", 1000}, {"doubleBridge", 1}, {"exchanges", 2}, {"orOpt", 0}},
+            [](const DataManager& instance, const ExperimentParams& params, int runs, const MultiStartOptions& options) {
+                IlsParams ils;
+                ils.iterations = static_cast<int>(getParam(params, "iterations", 1000));
+                ils.doubleBridge = getParam(params, "doubleBridge", 1) != 0;
+                ils.exchanges = static_cast<int>(getParam(params, "exchanges", 2));
+                ils.orOpt = getParam(params, "orOpt", 0) != 0;
+                return iteratedLocalSearch(instance.getDistanceMatrix(), instance.getCostVector(), instance.getSize(), ils, runs, options);
+            }};
+        registry["lns"] = {"LNS (destroy + weighted regret repair, candidate-list steepest)", "metaheuristic",
+                           {{"iterations", 1000}, {"destroyMin", 0.2}, {"destroyMax", 0.3}, {"destroy", 3}, {"alpha", 0.5},
+                            {"localSearch", 1}, {"K", 10}},
+            [](const DataManager& instance, const ExperimentParams& params, int runs, const MultiStartOptions& options) {
+                LnsParams lns;
+                lns.iterations = static_cast<int>(getParam(params, "iterations", 1000));
+                lns.destroyMin = getParam(params, "destroyMin", 0.2);
+                lns.destroyMax = getParam(params, "destroyMax", 0.3);
+                lns.destroy = static_cast<int>(getParam(params, "destroy", 3));
+                lns.alpha = getParam(params, "alpha", 0.5);
+                lns.localSearch = getParam(params, "localSearch", 1) != 0;
+                lns.K = static_cast<int>(getParam(params, "K", 10));
+                return largeNeighbourhoodSearch(instance.getDistanceMatrix(), instance.getCostVector(), instance.getSize(), lns, runs, options);
+            }};
+        registry["hea"] = {"HEA (steady state, common-node recombination, regret repair, candidate-list steepest)", "metaheuristic",
+                           {{"population", 20}, {"offspring", 2000}, {"batch", 4}, {"workers", 1}, {"alpha", 0.5},
+                            {"localSearch", 1}, {"K", 10}},
+            [](const DataManager& instance, const ExperimentParams& params, int runs, const MultiStartOptions& options) {
+                HeaParams hea;
+                hea.population = static_cast<int>(getParam(params, "population", 20));
+                hea.offspring = static_cast<int>(getParam(params, "offspring", 2000));
+                hea.batch = static_cast<int>(getParam(params, "batch", 4));
+                hea.workers = static_cast<int>(getParam(params, "workers", 1));
+                hea.alpha = getParam(params, "alpha", 0.5);
+                hea.localSearch = getParam(params, "localSearch", 1) != 0;
+                hea.K = static_cast<int>(getParam(params, "K", 10));
+                return hybridEvolutionary(instance.getDistanceMatrix(), instance.getCostVector(), instance.getSize(), hea, runs, options);
+            }};
+        registry["islands"] = {"Island model (ILS chains, lock-free migration ring)", "metaheuristic",
+                               {{"islands", 0}, {"iterations", 1000}, {"migrationInterval", 50}, {"doubleBridge", 1}, {"exchanges", 2},
+                                {"orOpt", 0}},
+            [](const DataManager& instance, const ExperimentParams& params, int runs, const MultiStartOptions& options) {
+                IslandParams islands;
+                islands.islands = static_cast<int>(getParam(params, "islands", 0));
+                islands.iterations = static_cast<int>(getParam(params, "iterations", 1000));
+                islands.migrationInterval = static_cast<int>(getParam(params, "migrationInterval", 50));
+                islands.ils.doubleBridge = getParam(params, "doubleBridge", 1) != 0;
+                islands.ils.exchanges = static_cast<int>(getParam(params, "exchanges", 2));
+                islands.ils.orOpt = getParam(params, "orOpt", 0) != 0;
+                return islandModel(instance.getDistanceMatrix(), instance.getCostVector(), instance.getSize(), islands, runs, options);
+            }};
+
+        return registry;
+    }
+}
+
+const std::map<std::string, MethodInfo>& getMethodRegistry() {
+    static const std::map<std::string, MethodInfo> registry = buildRegistry();
+    return registry;
+}
+
+std::map<std::string, ExperimentMethod> getSchedulableMethods() {
+    std::map<std::string, ExperimentMethod> methods;
+    for (const auto& entry : getMethodRegistry())
+        methods[entry.first] = entry.second.run;
+    return methods;
+}
+
+double getParam(const ExperimentParams& params, const std::string& name, double defaultValue) {
+    auto it = params.find(name);
+    return (it == params.end()) ? defaultValue : it->second;
+}
+
+int methodThreads(const ExperimentParams& params) {
+    // islands = 0 follows options.threads, which is 1 here
+    return std::max({1, static_cast<int>(getParam(params, "islands", 1)), static_cast<int>(getParam(params, "workers", 1))});
+}
+
+double movesEvaluated(const MultiStartResult& result) {
+    return static_cast<double>(result.counters.intraEvaluated + result.counters.exchangeEvaluated);
+}
+
+void printMultiStartResult(const std::string& title, const MultiStartResult& result) {
+    std::cout << "====== " << title << " ======\n";
+    std::cout << "  seed = " << result.masterSeed << " | threads = " << result.threads << "\n";
+    std::cout << "  runs = " << result.runs << "\n";
+    std::cout << "  min = " << result.bestObjective << "\n";
+    std::cout << "  max = " << result.worstObjective << "\n";
+    std::cout << "  avg = " << result.averageObjective() << "\n";
+    if (result.targetReached)
+        std::cout << "  target reached\n";
+    if (searchCountersEnabled && result.counters.runs > 0) {
+        // Summed counters are shown as a total and as the mean per run
+        result.counters.forEach([&](const char *name, uint64_t value, bool summed) {
+            std::cout << "  " << name << " = " << value;
+            if (summed) std::cout << " (" << static_cast<double>(value) / result.counters.runs << " per run)";
+            std::cout << "\n";
+        });
+    }
+    if (result.hardware.any()) {
+        // Misses are normalized by moves scored when counters are compiled in, by runs otherwise
+        double moves = movesEvaluated(result);
+        const char* unit = moves > 0 ? "move" : "run";
+        double per = moves > 0 ? moves : std::max(1, result.runs);
+        const PerfSample& hw = result.hardware;
+        for (int e = 0; e < PerfSample::EventCount; ++e) {
+            std::cout << "  " << PerfSample::name(e) << " = ";
+            if (hw.available[e]) std::cout << hw.values[e] << " (" << hw.values[e] / per << " per " << unit << ")";
+            else std::cout << "n/a";
+            std::cout << "\n";
+        }
+        if (hw.available[PerfSample::Cycles] && hw.available[PerfSample::Instructions] && hw.values[PerfSample::Cycles] > 0)
+            std::cout << "  IPC = " << static_cast<double>(hw.values[PerfSample::Instructions]) / hw.values[PerfSample::Cycles] << "\n";
+    }
+    std::cout << "Execution time (summed over tasks): " << result.elapsedSeconds << " seconds\n\n";
+
+    if (!result.bestSolution.empty()) {
+        std::cout << "Best cycle route: ";
+        for (const auto& n : result.bestSolution) std::cout << n << " ";
+        std::cout << result.bestSolution.front() << " (back to start)\n";
+    } else {
+        std::cout << "No solution found.\n";
+    }
+}
@@ -0,0 +1,33 @@
+#ifndef METHOD_REGISTRY_H
+#define METHOD_REGISTRY_H
+
+#include <map>
+#include <string>
+
+#include "experimentScheduler.h"
+
+struct MethodInfo {
+    std::string title;          // heading used in the human-readable report
+    std::string kind;           // "constructor", "localSearch" or "metaheuristic"
+    ExperimentParams defaults;  // parameters the method reads, with their default values
+    ExperimentMethod run;
+};
+
+// Every method of the assignments, keyed by the name used on the command line
+const std::map<std::string, MethodInfo>& getMethodRegistry();
+
+// The registry reduced to what runExperiment needs
+std::map<std::string, ExperimentMethod> getSchedulableMethods();
+
+double getParam(const ExperimentParams& params, const std::string& name, double defaultValue);
+
+// Threads a run starts itself when a method is invoked single-threaded: the islands of "islands" and the
+// workers of "hea", which a perf counter group on the calling thread does not see
+int methodThreads(const ExperimentParams& params);
+
+// Moves scored per run if counters are compiled in, otherwise 0
+double movesEvaluated(const MultiStartResult& result);
+
+void printMultiStartResult(const std::string& title, const MultiStartResult& result);
+
+#endif
@@ -0,0 +1,193 @@
+#include <new>
+#include <thread>
+#include <chrono>
+#include <iostream>
+#include <algorithm>
+
+#include "migrationRing.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#define EC_HAVE_SHM 1
+#endif
+
+namespace {
+    const uint64_t RING_MAGIC = 0x45434d4947524e31ULL; // "ECMIGRN1"
+    const size_t CACHE_LINE = 64;
+
+    size_t roundUp(size_t bytes) {
+        return (bytes + CACHE_LINE - 1) / CACHE_LINE * CACHE_LINE;
+    }
+}
+
+size_t MigrationRing::slotBytes(int maxNodes) {
+    return roundUp(sizeof(SlotHeader) + sizeof(std::atomic<int32_t>) * static_cast<size_t>(maxNodes));
+}
+
+size_t MigrationRing::blockBytes(int slots, int maxNodes) {
+    return roundUp(sizeof(Header)) + slotBytes(maxNodes) * static_cast<size_t>(slots);
+}
+
+MigrationRing::SlotHeader &MigrationRing::slot(size_t index) const {
+    return *reinterpret_cast<SlotHeader *>(block + roundUp(sizeof(Header)) + slotBytes(maxNodes) * index);
+}
+
+std::atomic<int32_t> *MigrationRing::nodes(size_t index) const {
+    return reinterpret_cast<std::atomic<int32_t> *>(reinterpret_cast<unsigned char *>(&slot(index)) + sizeof(SlotHeader));
+}
+
+void MigrationRing::initialize(uint64_t instanceHash) {
+    header = new (block) Header();
+    header->instanceHash.store(instanceHash, std::memory_order_relaxed);
+    header->slots.store(slotCount, std::memory_order_relaxed);
+    header->maxNodes.store(maxNodes, std::memory_order_relaxed);
+    header->attached.store(1, std::memory_order_relaxed);
+    header->head.store(0, std::memory_order_relaxed);
+    for (int s = 0; s < slotCount; ++s) {
+        SlotHeader *h = new (&slot(s)) SlotHeader();
+        h->sequence.store(0, std::memory_order_relaxed);
+        h->cost.store(0, std::memory_order_relaxed);
+        h->length.store(0, std::memory_order_relaxed);
+        std::atomic<int32_t> *n = nodes(s);
+        for (int i = 0; i < maxNodes; ++i)
+            new (&n[i]) std::atomic<int32_t>(0);
+    }
+    // Attaching processes wait for the magic word, so it goes last
+    header->magic.store(RING_MAGIC, std::memory_order_release);
+}
+
+void MigrationRing::allocatePrivate() {
+    bytes = blockBytes(slotCount, maxNodes);
+    block = static_cast<unsigned char *>(::operator new(bytes, std::align_val_t(CACHE_LINE)));
+    mapped = false;
+    initialize(0);
+}
+
+MigrationRing::MigrationRing(int slots, int maxNodes)
+    : slotCount(std::max(1, slots)), maxNodes(std::max(1, maxNodes)), block(nullptr), bytes(0), mapped(false), header(nullptr) {
+    allocatePrivate();
+}
+
+MigrationRing::MigrationRing(const std::string &name, uint64_t instanceHash, int slots, int maxNodes)
+    : slotCount(std::max(1, slots)), maxNodes(std::max(1, maxNodes)), block(nullptr), bytes(0), mapped(false),
+      name(name), header(nullptr) {
+#ifdef EC_HAVE_SHM
+    bytes = blockBytes(slotCount, this->maxNodes);
+    bool creator = true;
+    int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd == -1) {
+        creator = false;
+        fd = shm_open(name.c_str(), O_RDWR, 0600);
+    }
+    if (fd != -1) {
+        bool sized = creator ? ftruncate(fd, static_cast<off_t>(bytes)) == 0 : false;
+        // A creator in another process may not have sized the segment yet
+        for (int wait = 0; !creator && wait < 1000; ++wait) {
+            struct stat st;
+            if (fstat(fd, &st) == 0 && static_cast<size_t>(st.st_size) >= bytes) {
+                sized = static_cast<size_t>(st.st_size) == bytes;
+                break;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        void *address = sized ? mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0) : MAP_FAILED;
+        close(fd);
+
+        if (address != MAP_FAILED) {
+            block = static_cast<unsigned char *>(address);
+            mapped = true;
+            if (creator) {
+                initialize(instanceHash);
+            } else {
+                header = reinterpret_cast<Header *>(block);
+                for (int wait = 0; wait < 1000 && header->magic.load(std::memory_order_acquire) != RING_MAGIC; ++wait)
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                bool matches = header->magic.load(std::memory_order_acquire) == RING_MAGIC &&
+                               header->instanceHash.load() == instanceHash &&
+                               header->slots.load() == slotCount && header->maxNodes.load() == this->maxNodes;
+                if (matches) {
+                    header->attached.fetch_add(1);
+                } else {
+                    munmap(block, bytes);
+                    block = nullptr;
+                    mapped = false;
+                }
+            }
+        }
+    }
+    if (!mapped)
+        std::cerr << "Migration ring " << name << " is unavailable or belongs to another instance; using a private ring" << std::endl;
+#else
+    std::cerr << "No POSIX shared memory on this platform; using a private migration ring" << std::endl;
+#endif
+    if (!mapped) allocatePrivate();
+}
+
+MigrationRing::~MigrationRing() {
+#ifdef EC_HAVE_SHM
+    if (mapped) {
+        bool last = header->attached.fetch_sub(1) == 1;
+        munmap(block, bytes);
+        if (last) shm_unlink(name.c_str());
+        return;
+    }
+#endif
+    ::operator delete(block, std::align_val_t(CACHE_LINE));
+}
+
+uint64_t MigrationRing::head() const {
+    return header->head.load(std::memory_order_acquire);
+}
+
+bool MigrationRing::publish(int cost, const std::vector<int> &solution) {
+    int length = static_cast<int>(solution.size());
+    if (length > maxNodes) return false;
+
+    uint64_t ticket = header->head.fetch_add(1, std::memory_order_acq_rel);
+    size_t index = static_cast<size_t>(ticket % static_cast<uint64_t>(slotCount));
+    SlotHeader &s = slot(index);
+
+    // Claim the slot unless a publisher is writing it or already wrote a newer ticket into it
+    uint64_t seen = s.sequence.load(std::memory_order_relaxed);
+    if ((seen & 1) || seen > 2 * ticket) return false;
+    if (!s.sequence.compare_exchange_strong(seen, 2 * ticket + 1, std::memory_order_acquire, std::memory_order_relaxed))
+        return false;
+
+    s.cost.store(cost, std::memory_order_relaxed);
+    s.length.store(length, std::memory_order_relaxed);
+    std::atomic<int32_t> *n = nodes(index);
+    for (int i = 0; i < length; ++i)
+        n[i].store(solution[i], std::memory_order_relaxed);
+    s.sequence.store(2 * ticket + 2, std::memory_order_release);
+    return true;
+}
+
+void MigrationRing::collect(uint64_t &cursor, std::vector<Migrant> &migrants) const {
+    uint64_t end = head();
+    uint64_t capacity = static_cast<uint64_t>(slotCount);
+    if (end > cursor + capacity) cursor = end - capacity;
+
+    for (; cursor < end; ++cursor) {
+        size_t index = static_cast<size_t>(cursor % capacity);
+        const SlotHeader &s = slot(index);
+        uint64_t expected = 2 * cursor + 2;
+        uint64_t before = s.sequence.load(std::memory_order_acquire);
+        if (before == expected - 1) break; // still being written: read it next time
+        if (before != expected) continue;  // dropped by its publisher or already overwritten
+
+        Migrant migrant;
+        migrant.cost = s.cost.load(std::memory_order_relaxed);
+        int length = std::min(s.length.load(std::memory_order_relaxed), maxNodes);
+        const std::atomic<int32_t> *n = nodes(index);
+        migrant.solution.resize(std::max(0, length));
+        for (int i = 0; i < length; ++i)
+            migrant.solution[i] = n[i].load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (s.sequence.load(std::memory_order_relaxed) != expected) continue; // overwritten while copying
+        migrants.push_back(std::move(migrant));
+    }
+}
@@ -0,0 +1,84 @@
+#ifndef MIGRATION_RING_H
+#define MIGRATION_RING_H
+
+#include <atomic>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @brief Lock-free multi-producer ring of elite tours for the island model.
+ *
+ * A publisher takes a ticket from the shared head counter and claims slot
+ * ticket % slots by moving its sequence word from even (stable) to odd
+ * (being written); if another publisher holds the slot the tour is dropped
+ * instead of waited for, since a lost migrant costs nothing. Readers keep
+ * their own cursor and copy a slot seqlock style: the copy only counts if
+ * the sequence was 2 * (ticket + 1) before and after it. A reader that fell
+ * more than a ring behind skips to the oldest slot still intact.
+ *
+ * Everything, the node arrays included, lives in one block of lock-free
+ * atomics with no pointers, so the same ring works inside one process
+ * (heap block) and between processes (POSIX shared memory segment).
+ */
+class MigrationRing {
+public:
+    struct Migrant {
+        int cost;
+        std::vector<int> solution;
+    };
+
+    // Private ring in this process
+    MigrationRing(int slots, int maxNodes);
+    // Ring in the POSIX shared memory segment `name` (e.g. "/ec-islands"), created by the first
+    // process and attached by later ones; falls back to a private ring if that fails or the
+    // segment belongs to another instance (instanceHash, slots or maxNodes differ)
+    MigrationRing(const std::string &name, uint64_t instanceHash, int slots, int maxNodes);
+    ~MigrationRing();
+    MigrationRing(const MigrationRing &) = delete;
+    MigrationRing &operator=(const MigrationRing &) = delete;
+
+    bool isShared() const { return mapped; }
+
+    // Returns false if the slot was busy and the migrant was dropped
+    bool publish(int cost, const std::vector<int> &solution);
+    // Ticket the next publish() will take; a new reader starts here
+    uint64_t head() const;
+    // Appends every migrant published since cursor and advances it
+    void collect(uint64_t &cursor, std::vector<Migrant> &migrants) const;
+
+private:
+    struct Header {
+        std::atomic<uint64_t> magic;
+        std::atomic<uint64_t> instanceHash;
+        std::atomic<int32_t> slots;
+        std::atomic<int32_t> maxNodes;
+        std::atomic<int32_t> attached;
+        std::atomic<uint64_t> head;
+    };
+
+    struct SlotHeader {
+        std::atomic<uint64_t> sequence;
+        std::atomic<int32_t> cost;
+        std::atomic<int32_t> length;
+    };
+
+    static size_t slotBytes(int maxNodes);
+    static size_t blockBytes(int slots, int maxNodes);
+    void initialize(uint64_t instanceHash);
+    void allocatePrivate();
+
+    SlotHeader &slot(size_t index) const;
+    std::atomic<int32_t> *nodes(size_t index) const;
+
+    int slotCount;
+    int maxNodes;
+    unsigned char *block;
+    size_t bytes;
+    bool mapped;
+    std::string name;
+    Header *header;
+};
+
+#endif
@@ -0,0 +1,218 @@
+#ifndef MULTI_START_RUNNER_H
+#define MULTI_START_RUNNER_H
+
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <limits>
+#include <memory>
+#include <string>
+#include <cstdint>
+#include <cstdlib>
+#include <utility>
+#include <algorithm>
+
+#include "searchCounters.h"
+#include "perfCounters.h"
+#include "deadline.h"
+#include "incumbent.h"
+
+/**
+ * @brief Counter-based random stream for one run.
+ * The i-th output of stream (masterSeed, runId) is a SplitMix64 hash of
+ * (key, i), so a run draws the same numbers no matter which thread executes
+ * it or how many runs were executed before it.
+ * Satisfies UniformRandomBitGenerator, so it plugs into std::shuffle and
+ * std::uniform_int_distribution like std::mt19937 did.
+ */
+class RunRng {
+public:
+    using result_type = uint32_t;
+
+    RunRng(uint64_t masterSeed, uint64_t runId) : key(mix(masterSeed ^ mix(runId + 0x9E3779B97F4A7C15ULL))), counter(0) {}
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    result_type operator()() {
+        return static_cast<result_type>(mix(key + (++counter) * 0x9E3779B97F4A7C15ULL) >> 32);
+    }
+
+    static uint64_t mix(uint64_t z) {
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+private:
+    uint64_t key;
+    uint64_t counter;
+};
+
+struct RunResult {
+    int objective;
+    std::vector<int> solution;
+};
+
+/**
+ * @brief min/max/avg and best tour over a set of runs.
+ * Ties on the best objective go to the lowest run id, which makes the merged
+ * result independent of how runs were split between threads.
+ */
+struct MultiStartResult {
+    int runs = 0; // runs that produced a tour; a run cut off before it had one is not counted
+    int bestObjective = std::numeric_limits<int>::max();
+    int worstObjective = std::numeric_limits<int>::min();
+    long long totalSum = 0;
+    int bestRun = -1;
+    std::vector<int> bestSolution;
+    uint64_t masterSeed = 0;
+    int threads = 1;
+    double elapsedSeconds = 0.0;
+    bool targetReached = false; // the runs stopped early at the target objective (MultiStartOptions)
+    SearchCounters counters; // all zero unless built with EC_COUNTERS
+    PerfSample hardware;     // filled only by callers that wrap the invocation in a PerfCounterGroup
+
+    double averageObjective() const { return runs > 0 ? static_cast<double>(totalSum) / runs : 0.0; }
+
+    void add(int run, RunResult &&result) {
+        if (result.solution.empty()) return;
+        runs++;
+        totalSum += result.objective;
+        if (bestRun == -1 || result.objective < bestObjective || (result.objective == bestObjective && run < bestRun)) {
+            bestObjective = result.objective;
+            bestRun = run;
+            bestSolution = std::move(result.solution);
+        }
+        if (result.objective > worstObjective) worstObjective = result.objective;
+    }
+
+    void merge(MultiStartResult &&other) {
+        runs += other.runs;
+        totalSum += other.totalSum;
+        if (other.bestRun != -1 && (bestRun == -1 || other.bestObjective < bestObjective || (other.bestObjective == bestObjective && other.bestRun < bestRun))) {
+            bestObjective = other.bestObjective;
+            bestRun = other.bestRun;
+            bestSolution = std::move(other.bestSolution);
+        }
+        worstObjective = std::max(worstObjective, other.worstObjective);
+        targetReached = targetReached || other.targetReached;
+        counters.add(other.counters);
+        hardware.add(other.hardware);
+    }
+};
+
+struct MultiStartOptions {
+    uint64_t masterSeed;
+    int threads;
+    int firstRun = 0; // run ids are firstRun..firstRun+totalRuns-1, so a batch can be split into chunks
+    double timeLimitSeconds = 0.0; // anytime mode: stop starting runs and cut running searches short after this long
+    int scanThreads = 0;           // threads per run of the parallel steepest scans (scanTeamSize), 0 = the idle cores
+    int parallelScanSize = 1000;   // instance size from which the steepest scans run in parallel, <= 0 = never
+    int targetObjective = Incumbent::noTarget; // stop all runs once one reaches this objective or better
+    Incumbent *incumbent = nullptr; // shared with other runMultiStart calls (its own target applies), or one per call
+
+    // EC_SEED fixes the master seed (random otherwise), EC_THREADS the worker count (all cores otherwise),
+    // EC_SCAN_THREADS and EC_PARALLEL_SCAN_SIZE the parallel scan of the steepest searches, EC_TARGET the
+    // target objective
+    static MultiStartOptions fromEnvironment() {
+        MultiStartOptions options;
+        const char *seed = std::getenv("EC_SEED");
+        const char *threads = std::getenv("EC_THREADS");
+        const char *scanThreads = std::getenv("EC_SCAN_THREADS");
+        const char *parallelScanSize = std::getenv("EC_PARALLEL_SCAN_SIZE");
+        const char *target = std::getenv("EC_TARGET");
+        options.masterSeed = seed ? std::strtoull(seed, nullptr, 10)
+                                  : (static_cast<uint64_t>(std::random_device{}()) << 32) ^ std::random_device{}();
+        options.threads = threads ? std::atoi(threads) : static_cast<int>(std::thread::hardware_concurrency());
+        if (options.threads <= 0) options.threads = 1;
+        if (scanThreads) options.scanThreads = std::max(0, std::atoi(scanThreads));
+        if (parallelScanSize) options.parallelScanSize = std::atoi(parallelScanSize);
+        if (target) options.targetObjective = std::atoi(target);
+        return options;
+    }
+};
+
+/**
+ * @brief Runs runFn(run, rng) for totalRuns run ids starting at options.firstRun on a pool of threads.
+ * Workers claim run ids from an atomic counter and reduce into their own
+ * MultiStartResult; the partial results are merged after join, so the hot
+ * path takes no locks. runFn must only share read-only state between runs.
+ *
+ * With options.timeLimitSeconds > 0, totalRuns is only an upper bound (<= 0
+ * means unbounded): no run is started after the deadline, and the deadline is
+ * installed in Deadline::current() so searches return their current solution
+ * when it passes. The first run is always executed, so a result is always
+ * available; runs reports how many runs took place and produced a tour.
+ *
+ * Every run result is offered to the incumbent (options.incumbent or a
+ * private one), which is also Incumbent::current() during the runs. Once it
+ * reaches its target, no run starts and running searches stop as at the
+ * deadline; targetReached reports it.
+ */
+template <typename RunFn>
+MultiStartResult runMultiStart(int totalRuns, RunFn runFn, const MultiStartOptions &options = MultiStartOptions::fromEnvironment())
+{
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    bool timeLimited = options.timeLimitSeconds > 0;
+    Deadline::Clock::time_point deadline = Deadline::Clock::now() +
+        std::chrono::duration_cast<Deadline::Clock::duration>(std::chrono::duration<double>(options.timeLimitSeconds));
+    int runCap = (totalRuns > 0) ? totalRuns : (timeLimited ? std::numeric_limits<int>::max() : 0);
+
+    int threadCount = std::max(1, std::min(options.threads, runCap));
+    std::vector<MultiStartResult> partial(threadCount);
+    std::atomic<int> nextRun(0);
+
+    std::unique_ptr<Incumbent> ownIncumbent;
+    Incumbent *incumbent = options.incumbent;
+    if (!incumbent) {
+        ownIncumbent = std::make_unique<Incumbent>(options.targetObjective);
+        incumbent = ownIncumbent.get();
+    }
+    const std::atomic<bool> *stop = incumbent->stopFlag();
+
+    auto worker = [&](int workerId) {
+        Incumbent::current() = incumbent;
+        for (int k = nextRun.fetch_add(1); k < runCap; k = nextRun.fetch_add(1)) {
+            if (timeLimited && k > 0 && Deadline::Clock::now() >= deadline) break;
+            if (k > 0 && incumbent->targetReached()) break;
+
+            int run = options.firstRun + k;
+            RunRng rng(options.masterSeed, static_cast<uint64_t>(run));
+            if (searchCountersEnabled) runCounters() = SearchCounters();
+            if (timeLimited || stop)
+                Deadline::current() = Deadline(timeLimited ? deadline : Deadline::Clock::time_point::max(), stop);
+            else
+                Deadline::current() = Deadline();
+            RunResult result = runFn(run, rng);
+            incumbent->offer(result.objective, result.solution);
+            partial[workerId].add(run, std::move(result));
+            if (searchCountersEnabled) {
+                runCounters().runs = 1;
+                partial[workerId].counters.add(runCounters());
+            }
+        }
+        Deadline::current() = Deadline();
+        Incumbent::current() = nullptr;
+    };
+
+    std::vector<std::thread> pool;
+    for (int t = 1; t < threadCount; ++t) pool.emplace_back(worker, t);
+    worker(0);
+    for (auto &thread : pool) thread.join();
+
+    MultiStartResult result;
+    for (auto &part : partial) result.merge(std::move(part));
+    result.masterSeed = options.masterSeed;
+    result.threads = threadCount;
+    result.targetReached = incumbent->targetReached();
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    result.elapsedSeconds = std::chrono::duration<double>(endTime - startTime).count();
+    return result;
+}
+
+#endif
@@ -0,0 +1,20 @@
+#include <algorithm>
+
+#include "neighbourLists.h"
+
+NeighbourLists::NeighbourLists(int **distanceMatrix, int size, int length)
+    : length(length < 0 || length > size - 1 ? std::max(0, size - 1) : length),
+      entries(static_cast<size_t>(size) * this->length)
+{
+    std::vector<Entry> row;
+    row.reserve(std::max(0, size - 1));
+    for (int u = 0; u < size; ++u) {
+        row.clear();
+        for (int v = 0; v < size; ++v)
+            if (v != u) row.push_back({distanceMatrix[u][v], v});
+
+        auto closer = [](const Entry &l, const Entry &r) { return l.distance != r.distance ? l.distance < r.distance : l.node < r.node; };
+        std::partial_sort(row.begin(), row.begin() + this->length, row.end(), closer);
+        std::copy(row.begin(), row.begin() + this->length, entries.begin() + static_cast<size_t>(u) * this->length);
+    }
+}
@@ -0,0 +1,82 @@
+#ifndef NEIGHBOUR_LISTS_H
+#define NEIGHBOUR_LISTS_H
+
+#include <vector>
+
+#include "multiStartRunner.h"
+
+/**
+ * @brief Every node's other nodes sorted by distance (ties by id), with the
+ * distance stored next to the node id in one flat array, so a scan walks
+ * contiguous memory instead of indexing the distance matrix row by row.
+ *
+ * A 2-opt move that gains must create an edge (u, v) shorter than the tour
+ * edge it removes at u, on one of the four ends of the move. Scanning u's list
+ * on each side of u therefore stops at the first neighbour that is at least as
+ * far as that tour edge and still sees every improving 2-opt move
+ * (scanTwoOptAround). Lists cut to `length` entries lose that guarantee.
+ */
+class NeighbourLists {
+public:
+    struct Entry {
+        int distance;
+        int node;
+    };
+
+    NeighbourLists() = default;
+    // length < 0 keeps all size - 1 other nodes
+    NeighbourLists(int **distanceMatrix, int size, int length = -1);
+
+    const Entry *begin(int u) const { return entries.data() + static_cast<size_t>(u) * length; }
+    const Entry *end(int u) const { return begin(u) + length; }
+    bool empty() const { return entries.empty(); }
+
+private:
+    int length = 0;
+    std::vector<Entry> entries;
+};
+
+/**
+ * @brief Visits the 2-opt moves that add an edge (u, v) shorter than the tour
+ * edge between u and its successor (side = 1) or predecessor (side = -1), u
+ * at position uPos. fn(a, b) receives the positions a <= b of the segment
+ * whose reversal makes the move (TwoEdgeExchange::delta / apply) and returns
+ * true to stop; the result says whether it did. Neighbours outside the tour
+ * (pos -1) are passed over, the rest of the list after the bound is counted
+ * as intraSkipped.
+ *
+ * The gain of a move is the sum of two such one-sided gains, so a move that
+ * gains more than minGain has one of them above minGain / 2: the bound
+ * tightens by that much, also while fn raises minGain during the scan.
+ */
+template <typename Fn>
+bool scanTwoOptAround(const NeighbourLists &lists, int **distanceMatrix, const std::vector<int> &solution,
+                      const std::vector<int> &pos, int uPos, int side, const int &minGain, Fn fn) {
+    int n = static_cast<int>(solution.size());
+    int u = solution[uPos];
+    int nextPos = (uPos + 1) % n, prevPos = (uPos - 1 + n) % n;
+    int bound = 2 * distanceMatrix[u][solution[side == 1 ? nextPos : prevPos]];
+
+    for (const NeighbourLists::Entry *e = lists.begin(u), *last = lists.end(u); e != last; ++e) {
+        if (2 * e->distance >= bound - minGain) {
+            EC_COUNT(intraSkipped, last - e);
+            break;
+        }
+        int vPos = pos[e->node];
+        if (vPos == -1 || vPos == nextPos || vPos == prevPos) continue;
+
+        // Successor side: reverse u_next..v (or v_next..u); predecessor side: reverse v..u_prev (or u..v_prev)
+        int a, b;
+        if (side == 1) {
+            a = (uPos < vPos ? uPos : vPos) + 1;
+            b = uPos < vPos ? vPos : uPos;
+        } else {
+            a = vPos < uPos ? vPos : uPos;
+            b = (vPos < uPos ? uPos : vPos) - 1;
+        }
+        if (fn(a, b)) return true;
+    }
+    return false;
+}
+
+#endif
@@ -0,0 +1,88 @@
+#include "perfCounters.h"
+
+#ifdef __linux__
+
+#include <cstring>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+namespace {
+    struct EventSpec {
+        PerfSample::Event event;
+        uint32_t type;
+        uint64_t config;
+    };
+
+    const EventSpec eventSpecs[] = {
+        {PerfSample::Cycles, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+        {PerfSample::Instructions, PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+        {PerfSample::L1dReadMisses, PERF_TYPE_HW_CACHE,
+         PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+        {PerfSample::LlcMisses, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+        {PerfSample::BranchMisses, PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+    };
+
+    int openEvent(const EventSpec &spec, int groupFd) {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = spec.type;
+        attr.config = spec.config;
+        attr.disabled = (groupFd == -1) ? 1 : 0; // the leader gates the whole group
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, groupFd, 0));
+    }
+}
+
+PerfCounterGroup::PerfCounterGroup() : leader(-1) {
+    for (const auto &spec : eventSpecs) {
+        int fd = openEvent(spec, this->leader);
+        if (fd == -1)
+            continue; // unsupported event or no permission: report it as unavailable
+        if (this->leader == -1)
+            this->leader = fd;
+        this->counters.push_back({fd, spec.event});
+    }
+}
+
+PerfCounterGroup::~PerfCounterGroup() {
+    for (const auto &counter : this->counters)
+        close(counter.fd);
+}
+
+void PerfCounterGroup::start() {
+    if (this->leader == -1)
+        return;
+    ioctl(this->leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(this->leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+
+PerfSample PerfCounterGroup::stop() {
+    PerfSample sample;
+    if (this->leader == -1)
+        return sample;
+    ioctl(this->leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+    for (const auto &counter : this->counters) {
+        uint64_t data[3] = {0, 0, 0}; // value, time enabled, time running
+        if (read(counter.fd, data, sizeof(data)) != static_cast<ssize_t>(sizeof(data)) || data[2] == 0)
+            continue;
+        double scale = static_cast<double>(data[1]) / static_cast<double>(data[2]);
+        sample.values[counter.event] = static_cast<uint64_t>(static_cast<double>(data[0]) * scale);
+        sample.available[counter.event] = true;
+    }
+    return sample;
+}
+
+#else
+
+PerfCounterGroup::PerfCounterGroup() : leader(-1) {}
+PerfCounterGroup::~PerfCounterGroup() {}
+void PerfCounterGroup::start() {}
+PerfSample PerfCounterGroup::stop() { return PerfSample(); }
+
+#endif
@@ -0,0 +1,65 @@
+#ifndef PERF_COUNTERS_H
+#define PERF_COUNTERS_H
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Hardware event totals of one or more method invocations.
+ * Events the kernel refused to open (no PMU in a container, perf_event_paranoid,
+ * non-Linux builds) stay marked unavailable instead of reading as zero.
+ */
+struct PerfSample {
+    enum Event { Cycles, Instructions, L1dReadMisses, LlcMisses, BranchMisses, EventCount };
+
+    uint64_t values[EventCount] = {};
+    bool available[EventCount] = {};
+
+    bool any() const {
+        for (bool a : available) if (a) return true;
+        return false;
+    }
+
+    void add(const PerfSample &other) {
+        for (int e = 0; e < EventCount; ++e) {
+            values[e] += other.values[e];
+            available[e] = available[e] || other.available[e];
+        }
+    }
+
+    static const char *name(int event) {
+        static const char *names[EventCount] = {"cycles", "instructions", "l1dReadMisses", "llcMisses", "branchMisses"};
+        return names[event];
+    }
+};
+
+/**
+ * @brief perf_event_open counter group for the calling thread.
+ * The events are opened as one group so they are scheduled onto the PMU
+ * together; counts are scaled by enabled/running time if the kernel had to
+ * multiplex them. Every event that cannot be opened is skipped, and without
+ * any event start()/stop() are no-ops returning an empty sample.
+ */
+class PerfCounterGroup {
+public:
+    PerfCounterGroup();
+    ~PerfCounterGroup();
+    PerfCounterGroup(const PerfCounterGroup &) = delete;
+    PerfCounterGroup &operator=(const PerfCounterGroup &) = delete;
+
+    bool isAvailable() const { return leader != -1; }
+
+    void start();
+    PerfSample stop();
+
+private:
+    struct Counter {
+        int fd;
+        PerfSample::Event event;
+    };
+
+    int leader;
+    std::vector<Counter> counters;
+};
+
+#endif
@@ -0,0 +1,132 @@
+#include <vector>
+#include <algorithm>
+
+#include "regretInsertion.h"
+
+RegretInsertionTour::RegretInsertionTour(int **distanceMatrix, const std::vector<int> &costVector, int size)
+    : next(size, -1), prev(size, -1), insertion(size), stale(size, 1),
+      distanceMatrix(distanceMatrix), costVector(&costVector), size(size) {}
+
+std::vector<int> RegretInsertionTour::toSolution() const {
+    std::vector<int> solution;
+    solution.reserve(tourSize);
+    for (int v = anyNode, i = 0; i < tourSize; v = next[v], ++i)
+        solution.push_back(v);
+    return solution;
+}
+
+void RegretInsertionTour::start(int node) {
+    next[node] = prev[node] = node;
+    tourSize = 1;
+    anyNode = node;
+    cost = (*costVector)[node];
+    noteNewEdges({{node, node}});
+}
+
+void RegretInsertionTour::remove(int x) {
+    int p = prev[x], s = next[x];
+    next[p] = s;
+    prev[s] = p;
+    next[x] = prev[x] = -1;
+    --tourSize;
+    if (anyNode == x) anyNode = s;
+    cost -= (*costVector)[x] + distanceMatrix[p][x] + distanceMatrix[x][s] - distanceMatrix[p][s];
+    stale[x] = 1;
+    noteNewEdges({{p, s}});
+}
+
+void RegretInsertionTour::insert(int x, int a, int b) {
+    if (next[a] != b) std::swap(a, b);
+    // Below three nodes the same undirected edge is in the cycle twice, so the cache may hold it as both entries
+    if (tourSize <= 2) std::fill(stale.begin(), stale.end(), 1);
+    cost += insertionCost(x, a, b);
+    next[a] = x;
+    prev[x] = a;
+    next[x] = b;
+    prev[b] = x;
+    ++tourSize;
+    noteNewEdges({{a, x}, {x, b}});
+}
+
+void RegretInsertionTour::repair(int targetSize, double alpha) {
+    while (tourSize < targetSize) {
+        int bestNode = -1;
+        double bestScore = 0;
+        for (int c = 0; c < size; ++c) {
+            if (inTour(c)) continue;
+            if (stale[c]) rescan(c);
+            const Insertion &ins = insertion[c];
+            int regret = ins.cost2 == NO_INSERTION ? 0 : ins.cost2 - ins.cost1;
+            double score = alpha * regret - (1.0 - alpha) * ins.cost1;
+            if (bestNode == -1 || score > bestScore ||
+                (score == bestScore && ins.cost1 < insertion[bestNode].cost1)) {
+                bestNode = c;
+                bestScore = score;
+            }
+        }
+        const Insertion &chosen = insertion[bestNode];
+        insert(bestNode, chosen.a1, chosen.b1);
+    }
+}
+
+void RegretInsertionTour::assign(const std::vector<int> &solution, int solutionCost) {
+    std::vector<int> oldNext = next;
+    std::fill(next.begin(), next.end(), -1);
+    std::fill(prev.begin(), prev.end(), -1);
+    int n = static_cast<int>(solution.size());
+    for (int i = 0; i < n; ++i) {
+        next[solution[i]] = solution[(i + 1) % n];
+        prev[solution[(i + 1) % n]] = solution[i];
+    }
+    tourSize = n;
+    anyNode = n > 0 ? solution[0] : -1;
+    cost = solutionCost;
+    if (n <= 2) {
+        std::fill(stale.begin(), stale.end(), 1);
+        return;
+    }
+
+    std::vector<Edge> added;
+    for (int i = 0; i < n; ++i) {
+        int u = solution[i], v = solution[(i + 1) % n];
+        if (oldNext[u] != v && oldNext[v] != u) added.push_back({u, v});
+    }
+    for (int v = 0; v < size; ++v)
+        if (!inTour(v) && oldNext[v] != -1) stale[v] = 1;
+    noteNewEdges(added);
+}
+
+void RegretInsertionTour::offer(Insertion &ins, int cost, int a, int b) {
+    if (cost < ins.cost1) {
+        ins.cost2 = ins.cost1; ins.a2 = ins.a1; ins.b2 = ins.b1;
+        ins.cost1 = cost; ins.a1 = a; ins.b1 = b;
+    } else if (cost < ins.cost2) {
+        ins.cost2 = cost; ins.a2 = a; ins.b2 = b;
+    }
+}
+
+void RegretInsertionTour::rescan(int c) {
+    Insertion &ins = insertion[c];
+    ins = Insertion();
+    for (int v = anyNode, i = 0; i < tourSize; v = next[v], ++i)
+        offer(ins, insertionCost(c, v, next[v]), v, next[v]);
+    stale[c] = 0;
+}
+
+void RegretInsertionTour::noteNewEdges(std::initializer_list<Edge> edges) {
+    noteNewEdges(std::vector<Edge>(edges));
+}
+
+// The top two of the old edges that survived plus the new edges are the top two of the new tour
+void RegretInsertionTour::noteNewEdges(const std::vector<Edge> &edges) {
+    for (int c = 0; c < size; ++c) {
+        if (inTour(c) || stale[c]) continue;
+        Insertion &ins = insertion[c];
+        if (!hasEdge(ins.a1, ins.b1) || (ins.a2 != -1 && !hasEdge(ins.a2, ins.b2))) {
+            stale[c] = 1;
+            continue;
+        }
+        for (const Edge &e : edges)
+            offer(ins, insertionCost(c, e.a, e.b), e.a, e.b);
+    }
+}
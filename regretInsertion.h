@@ -0,0 +1,73 @@
+#ifndef REGRET_INSERTION_H
+#define REGRET_INSERTION_H
+
+#include <vector>
+#include <limits>
+#include <initializer_list>
+
+/**
+ * @brief Tour as a doubly linked cycle over node ids, with an incremental
+ * weighted 2-regret insertion cache for every node outside it.
+ * Each unselected node keeps its best and second-best insertion edge. An entry
+ * stays exact as long as both of its edges are still in the tour: every
+ * removal or insertion only offers the one or two new edges to it. An entry
+ * that lost an edge is marked stale and rescanned over the whole tour the next
+ * time repair() reads it, so growing the tour by k nodes costs O(k * size)
+ * plus the rescans instead of a full regret construction.
+ * Shared by the large neighbourhood search and the hybrid evolutionary algorithm.
+ */
+class RegretInsertionTour {
+public:
+    static constexpr int NO_INSERTION = std::numeric_limits<int>::max();
+
+    // Best and second-best insertion of an unselected node, between tour neighbours (a, b)
+    struct Insertion {
+        int cost1 = NO_INSERTION, a1 = -1, b1 = -1;
+        int cost2 = NO_INSERTION, a2 = -1, b2 = -1;
+    };
+
+    struct Edge {
+        int a, b;
+    };
+
+    std::vector<int> next, prev; // -1 if the node is not in the tour
+    std::vector<Insertion> insertion;
+    std::vector<char> stale;
+    int tourSize = 0;
+    int anyNode = -1;
+    int cost = 0;
+
+    RegretInsertionTour(int **distanceMatrix, const std::vector<int> &costVector, int size);
+
+    bool inTour(int node) const { return next[node] != -1; }
+    std::vector<int> toSolution() const;
+
+    void start(int node);
+    void remove(int x);
+    // Inserts x on the tour edge (a, b), given in either direction
+    void insert(int x, int a, int b);
+    // Grows the tour to targetSize by weighted 2-regret insertion over all unselected nodes
+    void repair(int targetSize, double alpha);
+    // Re-links the tour from a solution changed elsewhere (local search, recombination) and updates the cache by the edge difference
+    void assign(const std::vector<int> &solution, int solutionCost);
+
+private:
+    int **distanceMatrix;
+    const std::vector<int> *costVector;
+    int size;
+
+    int insertionCost(int c, int a, int b) const {
+        return (*costVector)[c] + distanceMatrix[a][c] + distanceMatrix[c][b] - distanceMatrix[a][b];
+    }
+
+    bool hasEdge(int a, int b) const {
+        return a != -1 && (next[a] == b || next[b] == a);
+    }
+
+    static void offer(Insertion &ins, int cost, int a, int b);
+    void rescan(int c);
+    void noteNewEdges(std::initializer_list<Edge> edges);
+    void noteNewEdges(const std::vector<Edge> &edges);
+};
+
+#endif
@@ -0,0 +1,79 @@
+#include <algorithm>
+
+#include "scanTeam.h"
+
+ScanTeam::ScanTeam(int parts)
+    : counters(std::max(1, parts)), reached(std::max(1, parts), 0)
+{
+    for (int part = 1; part < parts; ++part)
+        workers.emplace_back(&ScanTeam::workerLoop, this, part);
+}
+
+ScanTeam::~ScanTeam() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (auto &worker : workers) worker.join();
+}
+
+std::pair<int, int> ScanTeam::range(int part, int count) const {
+    long long n = parts();
+    return {static_cast<int>(count * part / n), static_cast<int>(count * (part + 1) / n)};
+}
+
+bool ScanTeam::dispatch() {
+    deadline = Deadline::current();
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        pending = static_cast<int>(workers.size());
+        ++generation;
+    }
+    wake.notify_all();
+
+    job(0);
+    bool anyReached = Deadline::current().reached();
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        done.wait(lock, [this] { return pending == 0; });
+    }
+
+    for (int part = 1; part < parts(); ++part) {
+        anyReached = anyReached || reached[part];
+        if (searchCountersEnabled) runCounters().add(counters[part]);
+    }
+    // A worker saw the deadline pass, so one clock read makes the caller's reached() agree
+    if (anyReached) Deadline::current().expired(Deadline::checkEvery);
+    return anyReached;
+}
+
+void ScanTeam::workerLoop(int part) {
+    uint64_t seen = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [&] { return stopping || generation != seen; });
+            if (stopping) return;
+            seen = generation;
+        }
+
+        Deadline::current() = deadline;
+        if (searchCountersEnabled) runCounters() = SearchCounters();
+        job(part);
+        reached[part] = Deadline::current().reached();
+        if (searchCountersEnabled) counters[part] = runCounters();
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (--pending == 0) done.notify_one();
+    }
+}
+
+int scanTeamSize(const MultiStartOptions &options, int size, int totalRuns) {
+    if (options.parallelScanSize <= 0 || size < options.parallelScanSize) return 1;
+    if (options.scanThreads > 0) return options.scanThreads;
+
+    int hardware = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    int concurrentRuns = std::max(1, totalRuns > 0 ? std::min(options.threads, totalRuns) : options.threads);
+    return std::max(1, hardware / concurrentRuns);
+}
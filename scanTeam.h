@@ -0,0 +1,74 @@
+#ifndef SCAN_TEAM_H
+#define SCAN_TEAM_H
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <cstdint>
+#include <utility>
+#include <functional>
+#include <condition_variable>
+
+#include "multiStartRunner.h"
+
+/**
+ * @brief Threads that stay parked for the whole of one local search run and
+ * evaluate a part of the neighbourhood each iteration.
+ *
+ * run(fn) wakes the workers, calls fn(part) for every part (part 0 on the
+ * calling thread) and returns once all parts are done, so the scans share
+ * nothing but read-only tour data and their own best-move slot. A part runs
+ * under a copy of the caller's Deadline::current(), which is reached
+ * afterwards if any part saw it pass, and the search counters it collects
+ * are added to the caller's when it finishes.
+ *
+ * The searches pick the best move from the per-part ones by (delta, scan
+ * phase, part) with parts over ascending positions, which is the move the
+ * serial scan keeps, so the result does not depend on the number of parts.
+ */
+class ScanTeam {
+public:
+    // parts includes the calling thread, so ScanTeam(1) runs everything inline
+    explicit ScanTeam(int parts);
+    ~ScanTeam();
+    ScanTeam(const ScanTeam &) = delete;
+    ScanTeam &operator=(const ScanTeam &) = delete;
+
+    int parts() const { return static_cast<int>(workers.size()) + 1; }
+
+    // [begin, end) of `part` when count items are cut into parts() even ranges
+    std::pair<int, int> range(int part, int count) const;
+
+    // Returns whether a part saw the deadline reached
+    template <typename Fn>
+    bool run(Fn &&fn) {
+        job = [&fn](int part) { fn(part); };
+        return dispatch();
+    }
+
+private:
+    bool dispatch();
+    void workerLoop(int part);
+
+    std::vector<std::thread> workers;
+    std::function<void(int)> job;
+    Deadline deadline;                // the caller's, copied into every part of the current job
+    std::vector<SearchCounters> counters;
+    std::vector<char> reached;
+
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+    uint64_t generation = 0;
+    int pending = 0;
+    bool stopping = false;
+};
+
+/**
+ * @brief Parts for the neighbourhood scan of a run on `size` nodes: 1 below
+ * options.parallelScanSize, else options.scanThreads, or when that is 0 the
+ * hardware threads the concurrently running runs leave idle.
+ */
+int scanTeamSize(const MultiStartOptions &options, int size, int totalRuns);
+
+#endif
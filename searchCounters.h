@@ -0,0 +1,75 @@
+#ifndef SEARCH_COUNTERS_H
+#define SEARCH_COUNTERS_H
+
+#include <cstdint>
+#include <algorithm>
+
+/**
+ * @brief Event counters of the local searches.
+ * Compiled in only with -DEC_COUNTERS (make COUNTERS=1); otherwise every
+ * EC_COUNT statement expands to nothing and the hot loops are unchanged.
+ * A run counts into the thread-local runCounters(), which runMultiStart
+ * resets before each run and folds into the MultiStartResult afterwards.
+ */
+struct SearchCounters {
+    uint64_t runs = 0;
+    uint64_t iterations = 0;          // improvement iterations until the local optimum
+    uint64_t intraEvaluated = 0;      // intra-route moves (node swap / 2-opt) scored
+    uint64_t intraSkipped = 0;        // neighbour-list entries a 2-opt scan cut off by the distance bound
+    uint64_t exchangeEvaluated = 0;   // selected/unselected node exchanges scored
+    uint64_t exchangeSkipped = 0;     // exchanges ruled out by the ExchangeOrder bound without scoring
+    uint64_t improvingFound = 0;      // scored moves with a negative delta
+    uint64_t movesApplied = 0;
+    uint64_t checkEdgeRejections = 0; // move-list entries dropped because one of their edges is gone
+    uint64_t staleReevaluations = 0;  // move-list entries that stopped improving on lazy re-evaluation
+    uint64_t moveListHighWater = 0;   // largest move list seen (max, not summed)
+    uint64_t knownOptimumHits = 0;    // runs stopped on a local optimum an earlier run already reached
+
+    void add(const SearchCounters &other) {
+        runs += other.runs;
+        iterations += other.iterations;
+        intraEvaluated += other.intraEvaluated;
+        intraSkipped += other.intraSkipped;
+        exchangeEvaluated += other.exchangeEvaluated;
+        exchangeSkipped += other.exchangeSkipped;
+        improvingFound += other.improvingFound;
+        movesApplied += other.movesApplied;
+        checkEdgeRejections += other.checkEdgeRejections;
+        staleReevaluations += other.staleReevaluations;
+        moveListHighWater = std::max(moveListHighWater, other.moveListHighWater);
+        knownOptimumHits += other.knownOptimumHits;
+    }
+
+    // Visits (name, value, summed) for every counter, in report order
+    template <typename Fn>
+    void forEach(Fn fn) const {
+        fn("iterations", iterations, true);
+        fn("intraEvaluated", intraEvaluated, true);
+        fn("intraSkipped", intraSkipped, true);
+        fn("exchangeEvaluated", exchangeEvaluated, true);
+        fn("exchangeSkipped", exchangeSkipped, true);
+        fn("improvingFound", improvingFound, true);
+        fn("movesApplied", movesApplied, true);
+        fn("checkEdgeRejections", checkEdgeRejections, true);
+        fn("staleReevaluations", staleReevaluations, true);
+        fn("moveListHighWater", moveListHighWater, false);
+        fn("knownOptimumHits", knownOptimumHits, true);
+    }
+};
+
+inline SearchCounters &runCounters() {
+    thread_local SearchCounters counters;
+    return counters;
+}
+
+#ifdef EC_COUNTERS
+constexpr bool searchCountersEnabled = true;
+#define EC_COUNT(field, n) (runCounters().field += static_cast<uint64_t>(n))
+#define EC_COUNT_MAX(field, value) (runCounters().field = std::max<uint64_t>(runCounters().field, static_cast<uint64_t>(value)))
+#else
+constexpr bool searchCountersEnabled = false;
+#define EC_COUNT(field, n) ((void)0)
+#define EC_COUNT_MAX(field, value) ((void)0)
+#endif
+
+#endif
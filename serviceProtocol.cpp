@@ -0,0 +1,201 @@
+#include <cerrno>
+#include <cstring>
+
+#include "serviceProtocol.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#include <sys/un.h>
+#include <sys/socket.h>
+#define EC_HAVE_UNIX_SOCKETS 1
+#endif
+
+ServiceMessage& ServiceMessage::putInt(int32_t value) {
+    append(&value, sizeof(value));
+    return *this;
+}
+
+ServiceMessage& ServiceMessage::putUint64(uint64_t value) {
+    append(&value, sizeof(value));
+    return *this;
+}
+
+ServiceMessage& ServiceMessage::putDouble(double value) {
+    append(&value, sizeof(value));
+    return *this;
+}
+
+ServiceMessage& ServiceMessage::putString(const std::string& value) {
+    putInt(static_cast<int32_t>(value.size()));
+    append(value.data(), value.size());
+    return *this;
+}
+
+ServiceMessage& ServiceMessage::putInts(const std::vector<int>& values) {
+    putInt(static_cast<int32_t>(values.size()));
+    for (int value : values)
+        putInt(value);
+    return *this;
+}
+
+int32_t ServiceMessage::getInt() {
+    int32_t value = 0;
+    take(&value, sizeof(value));
+    return value;
+}
+
+uint64_t ServiceMessage::getUint64() {
+    uint64_t value = 0;
+    take(&value, sizeof(value));
+    return value;
+}
+
+double ServiceMessage::getDouble() {
+    double value = 0.0;
+    take(&value, sizeof(value));
+    return value;
+}
+
+std::string ServiceMessage::getString() {
+    int32_t length = getInt();
+    if (length < 0 || static_cast<size_t>(length) > payload.size() - cursor) {
+        malformed = true;
+        return std::string();
+    }
+    std::string value(reinterpret_cast<const char*>(payload.data() + cursor), static_cast<size_t>(length));
+    cursor += static_cast<size_t>(length);
+    return value;
+}
+
+std::vector<int> ServiceMessage::getInts() {
+    int32_t count = getInt();
+    if (count < 0 || static_cast<size_t>(count) > (payload.size() - cursor) / sizeof(int32_t)) {
+        malformed = true;
+        return std::vector<int>();
+    }
+    std::vector<int> values(static_cast<size_t>(count));
+    for (int& value : values)
+        value = getInt();
+    return values;
+}
+
+void ServiceMessage::append(const void* data, size_t bytes) {
+    const unsigned char* first = static_cast<const unsigned char*>(data);
+    payload.insert(payload.end(), first, first + bytes);
+}
+
+bool ServiceMessage::take(void* data, size_t bytes) {
+    if (malformed || payload.size() - cursor < bytes) {
+        malformed = true;
+        return false;
+    }
+    std::memcpy(data, payload.data() + cursor, bytes);
+    cursor += bytes;
+    return true;
+}
+
+#ifdef EC_HAVE_UNIX_SOCKETS
+
+namespace {
+    bool writeAll(int fd, const unsigned char* data, size_t bytes) {
+        while (bytes > 0) {
+#ifdef MSG_NOSIGNAL
+            ssize_t written = ::send(fd, data, bytes, MSG_NOSIGNAL); // a vanished peer is an error, not SIGPIPE
+#else
+            ssize_t written = ::send(fd, data, bytes, 0);
+#endif
+            if (written < 0 && errno == EINTR) continue;
+            if (written <= 0) return false;
+            data += written;
+            bytes -= static_cast<size_t>(written);
+        }
+        return true;
+    }
+
+    bool readAll(int fd, unsigned char* data, size_t bytes) {
+        while (bytes > 0) {
+            ssize_t got = ::recv(fd, data, bytes, 0);
+            if (got < 0 && errno == EINTR) continue;
+            if (got <= 0) return false;
+            data += got;
+            bytes -= static_cast<size_t>(got);
+        }
+        return true;
+    }
+
+    bool fillAddress(const std::string& path, sockaddr_un& address) {
+        std::memset(&address, 0, sizeof(address));
+        address.sun_family = AF_UNIX;
+        if (path.empty() || path.size() >= sizeof(address.sun_path)) {
+            errno = ENAMETOOLONG;
+            return false;
+        }
+        std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+        return true;
+    }
+}
+
+bool ServiceMessage::send(int fd) const {
+    // Header and payload in one buffer, so a frame never interleaves with another writer's
+    uint32_t length = static_cast<uint32_t>(payload.size());
+    std::vector<unsigned char> frame(sizeof(length) + 1 + payload.size());
+    std::memcpy(frame.data(), &length, sizeof(length));
+    frame[sizeof(length)] = type;
+    if (!payload.empty())
+        std::memcpy(frame.data() + sizeof(length) + 1, payload.data(), payload.size());
+    return writeAll(fd, frame.data(), frame.size());
+}
+
+bool ServiceMessage::receive(int fd) {
+    unsigned char header[sizeof(uint32_t) + 1];
+    if (!readAll(fd, header, sizeof(header))) return false;
+    uint32_t length;
+    std::memcpy(&length, header, sizeof(length));
+    if (length > maxPayload) return false;
+
+    type = static_cast<Type>(header[sizeof(length)]);
+    payload.assign(length, 0);
+    cursor = 0;
+    malformed = false;
+    return length == 0 || readAll(fd, payload.data(), length);
+}
+
+int listenUnixSocket(const std::string& path) {
+    sockaddr_un address;
+    if (!fillAddress(path, address)) return -1;
+    int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) return -1;
+
+    ::unlink(path.c_str());
+    if (::bind(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0 || ::listen(fd, 16) < 0) {
+        int error = errno;
+        ::close(fd);
+        errno = error;
+        return -1;
+    }
+    return fd;
+}
+
+int connectUnixSocket(const std::string& path) {
+    sockaddr_un address;
+    if (!fillAddress(path, address)) return -1;
+    int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) return -1;
+
+    if (::connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0) {
+        int error = errno;
+        ::close(fd);
+        errno = error;
+        return -1;
+    }
+    return fd;
+}
+
+#else
+
+bool ServiceMessage::send(int) const { return false; }
+bool ServiceMessage::receive(int) { return false; }
+int listenUnixSocket(const std::string&) { errno = ENOSYS; return -1; }
+int connectUnixSocket(const std::string&) { errno = ENOSYS; return -1; }
+
+#endif
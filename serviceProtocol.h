@@ -0,0 +1,75 @@
+#ifndef SERVICE_PROTOCOL_H
+#define SERVICE_PROTOCOL_H
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @brief One frame of the solver daemon protocol over a Unix domain socket.
+ *
+ * A frame is a 4-byte payload length, a 1-byte message type and the payload.
+ * Fields are fixed-width and in host byte order, as both ends run on the
+ * same machine: int32, uint64, float64, strings and int arrays as an int32
+ * count followed by the bytes or elements.
+ *
+ *   Load     id, path                         -> Ok size | Error message
+ *   Solve    instance, method, timeLimit, seed, runs, threads, target,
+ *            param count, (name, value)...    -> Improved* then Done | Error message
+ *   Reoptimize instance, orOpt, tour, update count,
+ *            (node, fields, cost, x, y)..., append count,
+ *            (x, y, cost)...                  -> Done | Error message
+ *            (fields: 1 sets the cost, 2 the coordinates)
+ *   Shutdown                                  -> Ok 0
+ *   Improved objective, seconds, tour
+ *   Done     runs, min, max, avg, seconds, targetReached, best tour
+ *
+ * Getters past the end of the payload return zero values and mark the
+ * message malformed, so a handler reads all fields and checks valid() once.
+ */
+class ServiceMessage {
+public:
+    enum Type : uint8_t { Load = 1, Solve = 2, Shutdown = 3, Reoptimize = 4, Ok = 16, Improved = 17, Done = 18, Error = 19 };
+
+    static const uint32_t maxPayload = 64u << 20;
+
+    ServiceMessage() : type(Error) {}
+    explicit ServiceMessage(Type type) : type(type) {}
+
+    Type getType() const { return type; }
+    bool valid() const { return !malformed; }
+
+    ServiceMessage& putInt(int32_t value);
+    ServiceMessage& putUint64(uint64_t value);
+    ServiceMessage& putDouble(double value);
+    ServiceMessage& putString(const std::string& value);
+    ServiceMessage& putInts(const std::vector<int>& values);
+
+    int32_t getInt();
+    uint64_t getUint64();
+    double getDouble();
+    std::string getString();
+    std::vector<int> getInts();
+
+    // Whole frame or nothing; false on a closed or broken socket
+    bool send(int fd) const;
+    // Replaces this message with the next frame; false on end of stream, a broken socket or an oversized frame
+    bool receive(int fd);
+
+private:
+    void append(const void* data, size_t bytes);
+    bool take(void* data, size_t bytes);
+
+    Type type;
+    std::vector<unsigned char> payload;
+    size_t cursor = 0;
+    bool malformed = false;
+};
+
+// Socket bound and listening at path (a stale socket file is replaced), or -1 with errno set
+int listenUnixSocket(const std::string& path);
+// Socket connected to path, or -1 with errno set
+int connectUnixSocket(const std::string& path);
+
+#endif
@@ -0,0 +1,56 @@
+#include <algorithm>
+
+#include "solutionPool.h"
+
+std::mutex KnownOptima::registryMutex;
+std::map<std::pair<uint64_t, std::string>, std::unique_ptr<KnownOptima>> KnownOptima::registry;
+
+KnownOptima &KnownOptima::shared(uint64_t instanceHash, const std::string &search) {
+    std::lock_guard<std::mutex> lock(registryMutex);
+    std::unique_ptr<KnownOptima> &set = registry[{instanceHash, search}];
+    if (!set) set = std::make_unique<KnownOptima>();
+    return *set;
+}
+
+void KnownOptima::clearShared() {
+    std::lock_guard<std::mutex> lock(registryMutex);
+    registry.clear();
+}
+
+bool KnownOptima::contains(uint64_t hash, int cost) const {
+    Shard &s = shard(hash);
+    std::lock_guard<std::mutex> lock(s.mutex);
+    auto it = s.costs.find(hash);
+    return it != s.costs.end() && it->second == cost;
+}
+
+void KnownOptima::insert(uint64_t hash, int cost) {
+    if (entries.load(std::memory_order_relaxed) >= MAX_ENTRIES) return;
+    Shard &s = shard(hash);
+    std::lock_guard<std::mutex> lock(s.mutex);
+    if (s.costs.emplace(hash, cost).second) entries++;
+}
+
+bool ElitePool::offer(int cost, uint64_t hash, const std::vector<int> &solution) {
+    if (capacity <= 0 || contains(hash)) return false;
+
+    if (!full()) {
+        entries.push_back({cost, hash, solution});
+        hashes.insert(hash);
+        return true;
+    }
+
+    auto worst = std::max_element(entries.begin(), entries.end(),
+                                  [](const EliteEntry &l, const EliteEntry &r) { return l.cost < r.cost; });
+    if (cost >= worst->cost) return false;
+
+    hashes.erase(worst->hash);
+    *worst = {cost, hash, solution};
+    hashes.insert(hash);
+    return true;
+}
+
+const EliteEntry &ElitePool::best() const {
+    return *std::min_element(entries.begin(), entries.end(),
+                             [](const EliteEntry &l, const EliteEntry &r) { return l.cost < r.cost; });
+}
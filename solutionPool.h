@@ -0,0 +1,83 @@
+#ifndef SOLUTION_POOL_H
+#define SOLUTION_POOL_H
+
+#include <map>
+#include <vector>
+#include <mutex>
+#include <memory>
+#include <atomic>
+#include <string>
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+
+/**
+ * @brief Hashes (TourHash) of tours already known to be local optima of one
+ * search (neighbourhood + acceptance) on one instance.
+ * A run whose trajectory reaches one of them can stop, since the final scan
+ * would find no improving move. The objective is stored with the hash and
+ * must match too, which guards against hash collisions. Sharded locks keep
+ * concurrent runs from serializing on one mutex.
+ * Like the ConstructionCache, the sets live for the whole process, so runs
+ * split into scheduler chunks still share them; clearShared() drops them.
+ */
+class KnownOptima {
+public:
+    static constexpr size_t MAX_ENTRIES = 1 << 20; // per set; later optima are not recorded
+
+    static KnownOptima &shared(uint64_t instanceHash, const std::string &search);
+    static void clearShared();
+
+    bool contains(uint64_t hash, int cost) const;
+    void insert(uint64_t hash, int cost);
+
+private:
+    static constexpr int SHARDS = 16;
+
+    struct Shard {
+        mutable std::mutex mutex;
+        std::unordered_map<uint64_t, int> costs;
+    };
+
+    Shard &shard(uint64_t hash) const { return shards[hash % SHARDS]; }
+
+    mutable Shard shards[SHARDS];
+    std::atomic<size_t> entries{0};
+
+    static std::mutex registryMutex;
+    static std::map<std::pair<uint64_t, std::string>, std::unique_ptr<KnownOptima>> registry;
+};
+
+struct EliteEntry {
+    int cost;
+    uint64_t hash;
+    std::vector<int> solution;
+};
+
+/**
+ * @brief Bounded set of the best distinct tours, keyed by TourHash.
+ * A tour whose hash is already pooled is rejected; once the pool is full a
+ * new tour replaces the worst entry (the first one on ties) if it is better.
+ * Not synchronized: the owner inserts from one thread.
+ */
+class ElitePool {
+public:
+    explicit ElitePool(int capacity) : capacity(capacity) {}
+
+    // Returns false if the tour was a duplicate or not good enough for a full pool
+    bool offer(int cost, uint64_t hash, const std::vector<int> &solution);
+    bool contains(uint64_t hash) const { return hashes.count(hash) != 0; }
+
+    int size() const { return static_cast<int>(entries.size()); }
+    bool full() const { return size() >= capacity; }
+    const EliteEntry &operator[](int i) const { return entries[i]; }
+    // Lowest cost, the first entry on ties
+    const EliteEntry &best() const;
+
+private:
+    int capacity;
+    std::vector<EliteEntry> entries;
+    std::unordered_set<uint64_t> hashes;
+};
+
+#endif
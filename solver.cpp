@@ -0,0 +1,193 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstdlib>
+
+#include "methodRegistry.h"
+#include "perfCounters.h"
+
+/**
+ * @brief Single entry point for every method of the assignments.
+ *
+ *   solver --method M3 --method candidateListSteepest --instance TSPA.csv --instance TSPB.csv
+ *          [--runs 200] [--seed S] [--threads T] [--time-limit SECONDS] [--target OBJECTIVE]
+ *          [--param name=value] [--format json|csv|text] [--perf] [--list]
+ *
+ * One line (JSON object or CSV row) is streamed per (instance, method) as soon as it finishes.
+ * --target stops the runs of a combination as soon as one of them reaches that objective.
+ */
+
+namespace {
+    void printUsage(const char* program) {
+        std::cerr << "Usage: " << program << " --method NAME --instance FILE [--runs N] [--seed S] [--threads T]\n"
+                  << "       [--time-limit SECONDS] [--target OBJECTIVE] [--param name=value] [--format json|csv|text] [--perf] [--list]\n";
+    }
+
+    void listMethods() {
+        for (const auto& entry : getMethodRegistry()) {
+            std::cout << entry.first << " (" << entry.second.kind << ") - " << entry.second.title;
+            for (const auto& param : entry.second.defaults)
+                std::cout << " [" << param.first << "=" << param.second << "]";
+            std::cout << "\n";
+        }
+    }
+
+    std::string jsonEscape(const std::string& text) {
+        std::string escaped;
+        for (char c : text) {
+            if (c == '"' || c == '\\') escaped += '\\';
+            escaped += c;
+        }
+        return escaped;
+    }
+
+    void printJson(const ExperimentOutcome& outcome) {
+        const MultiStartResult& result = outcome.result;
+        std::cout << "{\"instance\":\"" << jsonEscape(outcome.instance) << "\",\"method\":\"" << jsonEscape(outcome.method) << "\",\"params\":{";
+        bool first = true;
+        for (const auto& param : outcome.params) {
+            std::cout << (first ? "" : ",") << "\"" << jsonEscape(param.first) << "\":" << param.second;
+            first = false;
+        }
+        std::cout << "},\"runs\":" << result.runs << ",\"seed\":" << result.masterSeed << ",\"threads\":" << result.threads;
+        if (result.bestRun != -1)
+            std::cout << ",\"min\":" << result.bestObjective << ",\"max\":" << result.worstObjective << ",\"avg\":" << result.averageObjective();
+        if (result.targetReached)
+            std::cout << ",\"targetReached\":true";
+        if (searchCountersEnabled) {
+            std::cout << ",\"counters\":{\"runs\":" << result.counters.runs;
+            result.counters.forEach([](const char *name, uint64_t value, bool) { std::cout << ",\"" << name << "\":" << value; });
+            std::cout << "}";
+        }
+        if (result.hardware.any()) {
+            // Unavailable events are null, so a container without a PMU still yields valid JSON
+            std::cout << ",\"perf\":{";
+            for (int e = 0; e < PerfSample::EventCount; ++e) {
+                std::cout << (e > 0 ? "," : "") << "\"" << PerfSample::name(e) << "\":";
+                if (result.hardware.available[e]) std::cout << result.hardware.values[e];
+                else std::cout << "null";
+            }
+            std::cout << "}";
+        }
+        std::cout << ",\"seconds\":" << result.elapsedSeconds << ",\"best\":[";
+        for (size_t i = 0; i < result.bestSolution.size(); ++i)
+            std::cout << (i > 0 ? "," : "") << result.bestSolution[i];
+        std::cout << "]}" << std::endl;
+    }
+
+    void printCsvHeader() {
+        std::cout << "instance;method;params;runs;seed;threads;min;max;avg;seconds;best" << std::endl;
+    }
+
+    void printCsv(const ExperimentOutcome& outcome) {
+        const MultiStartResult& result = outcome.result;
+        std::cout << outcome.instance << ";" << outcome.method << ";";
+        bool first = true;
+        for (const auto& param : outcome.params) {
+            std::cout << (first ? "" : ",") << param.first << "=" << param.second;
+            first = false;
+        }
+        std::cout << ";" << result.runs << ";" << result.masterSeed << ";" << result.threads << ";";
+        if (result.bestRun != -1)
+            std::cout << result.bestObjective << ";" << result.worstObjective << ";" << result.averageObjective() << ";";
+        else
+            std::cout << ";;;";
+        std::cout << result.elapsedSeconds << ";";
+        for (size_t i = 0; i < result.bestSolution.size(); ++i)
+            std::cout << (i > 0 ? " " : "") << result.bestSolution[i];
+        std::cout << std::endl;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    ExperimentSpec spec;
+    ExperimentParams params;
+    std::string format = "json";
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--list") {
+            listMethods();
+            return 0;
+        }
+        if (arg == "--perf") {
+            spec.hardwareCounters = true;
+            continue;
+        }
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for " << arg << std::endl;
+            printUsage(argv[0]);
+            return 1;
+        }
+        std::string value = argv[++i];
+
+        if (arg == "--method") {
+            spec.methods.push_back(value);
+        } else if (arg == "--instance") {
+            spec.instances.push_back(value);
+        } else if (arg == "--runs") {
+            spec.runs = std::atoi(value.c_str());
+        } else if (arg == "--seed") {
+            setenv("EC_SEED", value.c_str(), 1);
+        } else if (arg == "--threads") {
+            spec.threads = std::atoi(value.c_str());
+        } else if (arg == "--target") {
+            setenv("EC_TARGET", value.c_str(), 1);
+        } else if (arg == "--time-limit") {
+            spec.timeLimitSeconds = std::atof(value.c_str());
+        } else if (arg == "--param") {
+            size_t eq = value.find('=');
+            if (eq == std::string::npos) {
+                std::cerr << "Invalid parameter (expected name=value): " << value << std::endl;
+                return 1;
+            }
+            params[value.substr(0, eq)] = std::atof(value.substr(eq + 1).c_str());
+        } else if (arg == "--format") {
+            format = value;
+        } else {
+            std::cerr << "Unknown option: " << arg << std::endl;
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    // With a time limit, --runs 0 means "as many runs as fit into the budget"
+    if (spec.methods.empty() || spec.instances.empty() || (spec.runs <= 0 && spec.timeLimitSeconds <= 0)) {
+        printUsage(argv[0]);
+        return 1;
+    }
+    if (format != "json" && format != "csv" && format != "text") {
+        std::cerr << "Unknown format: " << format << std::endl;
+        return 1;
+    }
+
+    const auto& registry = getMethodRegistry();
+    for (const auto& name : spec.methods) {
+        if (registry.find(name) == registry.end()) {
+            std::cerr << "Unknown method: " << name << " (see --list)" << std::endl;
+            return 1;
+        }
+    }
+    spec.parameterSets = {params};
+
+    if (spec.hardwareCounters && !PerfCounterGroup().isAvailable())
+        std::cerr << "Hardware counters are unavailable (perf_event_open refused); continuing without them" << std::endl;
+    if (spec.hardwareCounters && methodThreads(params) > 1) {
+        std::cerr << "Hardware counters only count the calling thread, and the runs use " << methodThreads(params)
+                  << " threads; continuing without them" << std::endl;
+        spec.hardwareCounters = false;
+    }
+
+    if (format == "csv")
+        printCsvHeader();
+    runExperiment(spec, getSchedulableMethods(), [&](const ExperimentOutcome& outcome) {
+        if (format == "json")
+            printJson(outcome);
+        else if (format == "csv")
+            printCsv(outcome);
+        else
+            printMultiStartResult(outcome.method + " on " + outcome.instance, outcome.result);
+    });
+
+    return 0;
+}
@@ -0,0 +1,239 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <limits>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+
+#include "serviceProtocol.h"
+#include "multiStartRunner.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
+/**
+ * @brief Command line client of solverDaemon.
+ *
+ *   solverClient --socket /tmp/ec.sock [--load ID=FILE]...
+ *                [--instance ID --method M [--runs N] [--time-limit SECONDS] [--seed S] [--threads T]
+ *                 [--target OBJECTIVE] [--param name=value]]
+ *                [--instance ID --tour N,N,... [--cost NODE=COST]... [--move NODE=X,Y]... [--add X,Y,COST]...
+ *                 [--param orOpt=1]]
+ *                [--shutdown]
+ *
+ * Loads, then solves or re-optimizes, then shuts down, in that order, over
+ * one connection. Every improved tour the daemon streams is printed as one
+ * JSON line, the final result as another; --runs defaults to 1 when no time
+ * limit is given. With --tour, the daemon applies the cost and coordinate
+ * changes to the instance, appends the --add nodes (numbered from its old
+ * size on) and re-optimizes or extends that tour instead (warmStart.h).
+ */
+
+namespace {
+    void printUsage(const char* program) {
+        std::cerr << "Usage: " << program << " --socket PATH [--load ID=FILE]... [--instance ID --method M [--runs N]\n"
+                  << "       [--time-limit SECONDS] [--seed S] [--threads T] [--target OBJECTIVE] [--param name=value]]\n"
+                  << "       [--instance ID --tour N,N,... [--cost NODE=COST]... [--move NODE=X,Y]... [--add X,Y,COST]...]\n"
+                  << "       [--shutdown]\n";
+    }
+
+    // "1,2,3" -> {1, 2, 3}
+    std::vector<int> parseInts(const std::string& text) {
+        std::vector<int> values;
+        size_t start = 0;
+        while (start < text.size()) {
+            size_t end = text.find(',', start);
+            if (end == std::string::npos) end = text.size();
+            values.push_back(std::atoi(text.substr(start, end - start).c_str()));
+            start = end + 1;
+        }
+        return values;
+    }
+
+    void printTour(const std::vector<int>& tour) {
+        std::cout << "[";
+        for (size_t i = 0; i < tour.size(); ++i)
+            std::cout << (i > 0 ? "," : "") << tour[i];
+        std::cout << "]";
+    }
+
+    // Prints the reply; false on an error reply or a broken connection
+    bool expectOk(int fd, const std::string& what) {
+        ServiceMessage reply;
+        if (!reply.receive(fd)) {
+            std::cerr << what << ": connection lost" << std::endl;
+            return false;
+        }
+        if (reply.getType() == ServiceMessage::Error) {
+            std::cerr << what << ": " << reply.getString() << std::endl;
+            return false;
+        }
+        return reply.getType() == ServiceMessage::Ok;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    std::string socketPath, instance, method;
+    std::vector<std::string> loads;
+    std::vector<std::pair<std::string, double>> params;
+    std::vector<int> tour;
+    struct Update { int node, fields, cost, x, y; };
+    std::vector<Update> updates;
+    std::vector<std::vector<int>> appended;
+    bool reoptimize = false;
+    double timeLimit = 0.0;
+    int runs = 0, threads = 0, target = Incumbent::noTarget;
+    uint64_t seed = MultiStartOptions::fromEnvironment().masterSeed;
+    bool shutdown = false;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--shutdown") {
+            shutdown = true;
+            continue;
+        }
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for " << arg << std::endl;
+            printUsage(argv[0]);
+            return 1;
+        }
+        std::string value = argv[++i];
+
+        if (arg == "--socket") {
+            socketPath = value;
+        } else if (arg == "--load") {
+            loads.push_back(value);
+        } else if (arg == "--instance") {
+            instance = value;
+        } else if (arg == "--method") {
+            method = value;
+        } else if (arg == "--runs") {
+            runs = std::atoi(value.c_str());
+        } else if (arg == "--time-limit") {
+            timeLimit = std::atof(value.c_str());
+        } else if (arg == "--seed") {
+            seed = std::strtoull(value.c_str(), nullptr, 10);
+        } else if (arg == "--threads") {
+            threads = std::atoi(value.c_str());
+        } else if (arg == "--target") {
+            target = std::atoi(value.c_str());
+        } else if (arg == "--tour") {
+            tour = parseInts(value);
+            reoptimize = true;
+        } else if (arg == "--cost" || arg == "--move") {
+            size_t eq = value.find('=');
+            std::vector<int> fields = eq == std::string::npos ? std::vector<int>() : parseInts(value.substr(eq + 1));
+            if (fields.size() != (arg == "--cost" ? 1u : 2u)) {
+                std::cerr << "Invalid " << arg << " (expected " << (arg == "--cost" ? "NODE=COST" : "NODE=X,Y") << "): " << value << std::endl;
+                return 1;
+            }
+            int node = std::atoi(value.substr(0, eq).c_str());
+            if (arg == "--cost")
+                updates.push_back({node, 1, fields[0], 0, 0});
+            else
+                updates.push_back({node, 2, 0, fields[0], fields[1]});
+        } else if (arg == "--add") {
+            std::vector<int> row = parseInts(value);
+            if (row.size() != 3) {
+                std::cerr << "Invalid --add (expected X,Y,COST): " << value << std::endl;
+                return 1;
+            }
+            appended.push_back(row);
+        } else if (arg == "--param") {
+            size_t eq = value.find('=');
+            if (eq == std::string::npos) {
+                std::cerr << "Invalid parameter (expected name=value): " << value << std::endl;
+                return 1;
+            }
+            params.push_back({value.substr(0, eq), std::atof(value.substr(eq + 1).c_str())});
+        } else {
+            std::cerr << "Unknown option: " << arg << std::endl;
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+    // An instance goes with exactly one of --method and --tour
+    if (socketPath.empty() || instance.empty() != (method.empty() == !reoptimize) || (!method.empty() && reoptimize)) {
+        printUsage(argv[0]);
+        return 1;
+    }
+    if (runs <= 0 && timeLimit <= 0) runs = 1;
+
+    int fd = connectUnixSocket(socketPath);
+    if (fd < 0) {
+        std::cerr << "Cannot connect to " << socketPath << ": " << std::strerror(errno) << std::endl;
+        return 1;
+    }
+
+    int status = 0;
+    for (const auto& load : loads) {
+        size_t eq = load.find('=');
+        std::string id = eq == std::string::npos ? load : load.substr(0, eq);
+        std::string path = eq == std::string::npos ? load : load.substr(eq + 1);
+        if (!ServiceMessage(ServiceMessage::Load).putString(id).putString(path).send(fd) || !expectOk(fd, "load " + id))
+            status = 1;
+    }
+
+    if (status == 0 && !instance.empty()) {
+        ServiceMessage request(reoptimize ? ServiceMessage::Reoptimize : ServiceMessage::Solve);
+        if (reoptimize) {
+            bool orOpt = false;
+            for (const auto& param : params)
+                if (param.first == "orOpt") orOpt = param.second != 0;
+            request.putString(instance).putInt(orOpt ? 1 : 0).putInts(tour).putInt(static_cast<int32_t>(updates.size()));
+            for (const Update& update : updates)
+                request.putInt(update.node).putInt(update.fields).putInt(update.cost).putInt(update.x).putInt(update.y);
+            request.putInt(static_cast<int32_t>(appended.size()));
+            for (const auto& row : appended)
+                request.putInt(row[0]).putInt(row[1]).putInt(row[2]);
+            method = "reoptimize";
+        } else {
+            request.putString(instance).putString(method).putDouble(timeLimit).putUint64(seed)
+                   .putInt(runs).putInt(threads).putInt(target).putInt(static_cast<int32_t>(params.size()));
+            for (const auto& param : params)
+                request.putString(param.first).putDouble(param.second);
+        }
+        status = request.send(fd) ? 0 : 1;
+
+        ServiceMessage reply;
+        while (status == 0) {
+            if (!reply.receive(fd)) {
+                std::cerr << method << ": connection lost" << std::endl;
+                status = 1;
+            } else if (reply.getType() == ServiceMessage::Improved) {
+                int objective = reply.getInt();
+                double seconds = reply.getDouble();
+                std::vector<int> tour = reply.getInts();
+                std::cout << "{\"event\":\"improved\",\"objective\":" << objective << ",\"seconds\":" << seconds << ",\"tour\":";
+                printTour(tour);
+                std::cout << "}" << std::endl;
+            } else if (reply.getType() == ServiceMessage::Done) {
+                int doneRuns = reply.getInt(), min = reply.getInt(), max = reply.getInt();
+                double avg = reply.getDouble(), seconds = reply.getDouble();
+                bool targetReached = reply.getInt() != 0;
+                std::vector<int> best = reply.getInts();
+                std::cout << "{\"event\":\"done\",\"instance\":\"" << instance << "\",\"method\":\"" << method << "\",\"runs\":" << doneRuns
+                          << ",\"seed\":" << seed << ",\"min\":" << min << ",\"max\":" << max << ",\"avg\":" << avg;
+                if (targetReached)
+                    std::cout << ",\"targetReached\":true";
+                std::cout << ",\"seconds\":" << seconds << ",\"best\":";
+                printTour(best);
+                std::cout << "}" << std::endl;
+                break;
+            } else {
+                std::cerr << method << ": " << (reply.getType() == ServiceMessage::Error ? reply.getString() : "unexpected reply") << std::endl;
+                status = 1;
+            }
+        }
+    }
+
+    if (shutdown && (!ServiceMessage(ServiceMessage::Shutdown).send(fd) || !expectOk(fd, "shutdown")))
+        status = 1;
+
+#if defined(__unix__) || defined(__APPLE__)
+    ::close(fd);
+#endif
+    return status;
+}
@@ -0,0 +1,69 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstdlib>
+
+#include "solverService.h"
+#include "multiStartRunner.h"
+
+/**
+ * @brief Solver daemon: keeps instances resident and answers solve requests over a Unix socket.
+ *
+ *   solverDaemon --socket /tmp/ec.sock [--instance [ID=]FILE]... [--threads T]
+ *
+ * An instance loaded without an ID is known by its file name. solverClient
+ * loads more instances, solves and shuts the daemon down.
+ */
+
+namespace {
+    void printUsage(const char* program) {
+        std::cerr << "Usage: " << program << " --socket PATH [--instance [ID=]FILE]... [--threads T]\n";
+    }
+}
+
+int main(int argc, char* argv[]) {
+    std::string socketPath;
+    int threads = MultiStartOptions::fromEnvironment().threads;
+    std::vector<std::string> instances;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for " << arg << std::endl;
+            printUsage(argv[0]);
+            return 1;
+        }
+        std::string value = argv[++i];
+
+        if (arg == "--socket") {
+            socketPath = value;
+        } else if (arg == "--instance") {
+            instances.push_back(value);
+        } else if (arg == "--threads") {
+            threads = std::atoi(value.c_str());
+        } else {
+            std::cerr << "Unknown option: " << arg << std::endl;
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+    if (socketPath.empty()) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    SolverService service(threads);
+    for (const auto& instance : instances) {
+        size_t eq = instance.find('=');
+        std::string id = eq == std::string::npos ? instance : instance.substr(0, eq);
+        std::string path = eq == std::string::npos ? instance : instance.substr(eq + 1);
+        std::string error;
+        if (!service.load(id, path, error)) {
+            std::cerr << error << std::endl;
+            return 1;
+        }
+    }
+
+    std::cerr << "Listening on " << socketPath << std::endl;
+    return service.serve(socketPath) ? 0 : 1;
+}
@@ -0,0 +1,276 @@
+#include <thread>
+#include <chrono>
+#include <vector>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+
+#include "solverService.h"
+#include "serviceProtocol.h"
+#include "methodRegistry.h"
+#include "fileReader.h"
+#include "localSearch.h"
+#include "candidateListCache.h"
+#include "incumbent.h"
+#include "warmStart.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#include <sys/socket.h>
+#endif
+
+namespace {
+    const auto pollInterval = std::chrono::milliseconds(2);
+
+    bool sendError(int fd, const std::string& message) {
+        return ServiceMessage(ServiceMessage::Error).putString(message).send(fd);
+    }
+}
+
+// On before the first load, so instances preloaded from the command line are cached as well
+SolverService::SolverService(int threads) : threads(std::max(1, threads)) {
+    CandidateListCache::shared().enable();
+}
+
+SolverService::Resident::~Resident() {
+    CandidateListCache::shared().forget(this->instance.getDistanceMatrix());
+}
+
+bool SolverService::load(const std::string& id, const std::string& path, std::string& error) {
+    std::vector<std::vector<int>> data;
+    FileReader reader(path);
+    if (!reader.getDataFromFile(data) || data.empty()) {
+        error = "Failed to read data from file: " + path;
+        return false;
+    }
+
+    // The last request using a replaced instance frees it
+    auto resident = std::make_shared<Resident>(data);
+    // K = 10 is the default of the candidate-list methods; other lengths are built by their first request
+    createCandidateList(resident->instance.getDistanceMatrix(), resident->instance.getCostVector(), resident->instance.getSize());
+
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->instances[id] = resident;
+    return true;
+}
+
+std::shared_ptr<SolverService::Resident> SolverService::find(const std::string& id) {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    auto it = this->instances.find(id);
+    return it == this->instances.end() ? nullptr : it->second;
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+
+bool SolverService::serve(const std::string& socketPath) {
+    this->listenFd = listenUnixSocket(socketPath);
+    if (this->listenFd < 0) {
+        std::cerr << "Cannot listen on " << socketPath << ": " << std::strerror(errno) << std::endl;
+        return false;
+    }
+
+    while (!this->stopping) {
+        int fd = ::accept(this->listenFd, nullptr, nullptr);
+        if (fd < 0) {
+            if (this->stopping) break;
+            if (errno == EINTR || errno == ECONNABORTED) continue;
+            std::cerr << "accept failed: " << std::strerror(errno) << std::endl;
+            break;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            this->connections.insert(fd);
+            this->activeConnections++;
+        }
+        std::thread([this, fd]() {
+            handle(fd);
+            std::lock_guard<std::mutex> lock(this->mutex);
+            this->connections.erase(fd);
+            ::close(fd);
+            if (--this->activeConnections == 0) this->idle.notify_all();
+        }).detach();
+    }
+
+    ::close(this->listenFd);
+    ::unlink(socketPath.c_str());
+
+    // Connections waiting for a request end now; those in a solve end after sending its result
+    std::unique_lock<std::mutex> lock(this->mutex);
+    for (int fd : this->connections)
+        ::shutdown(fd, SHUT_RD);
+    this->idle.wait(lock, [this]() { return this->activeConnections == 0; });
+    return true;
+}
+
+void SolverService::handle(int fd) {
+    ServiceMessage request;
+    while (request.receive(fd)) {
+        if (request.getType() == ServiceMessage::Load) {
+            std::string id = request.getString(), path = request.getString(), error;
+            if (!request.valid()) {
+                sendError(fd, "Malformed load request");
+            } else if (load(id, path, error)) {
+                ServiceMessage(ServiceMessage::Ok).putInt(find(id)->instance.getSize()).send(fd);
+            } else {
+                sendError(fd, error);
+            }
+        } else if (request.getType() == ServiceMessage::Solve) {
+            solve(fd, request);
+        } else if (request.getType() == ServiceMessage::Reoptimize) {
+            reoptimize(fd, request);
+        } else if (request.getType() == ServiceMessage::Shutdown) {
+            this->stopping = true;
+            ::shutdown(this->listenFd, SHUT_RDWR); // wakes the accept loop
+            ServiceMessage(ServiceMessage::Ok).putInt(0).send(fd);
+            return;
+        } else {
+            sendError(fd, "Unknown request type " + std::to_string(request.getType()));
+            return;
+        }
+    }
+}
+
+void SolverService::solve(int fd, ServiceMessage& request) {
+    std::string instanceId = request.getString();
+    std::string methodName = request.getString();
+    double timeLimit = request.getDouble();
+    uint64_t seed = request.getUint64();
+    int runs = request.getInt();
+    int requestThreads = request.getInt();
+    int target = request.getInt();
+    int paramCount = request.getInt();
+    ExperimentParams params;
+    for (int p = 0; p < paramCount && request.valid(); ++p) {
+        std::string name = request.getString();
+        params[name] = request.getDouble();
+    }
+
+    if (!request.valid()) {
+        sendError(fd, "Malformed solve request");
+        return;
+    }
+    std::shared_ptr<Resident> resident = find(instanceId);
+    if (!resident) {
+        sendError(fd, "Unknown instance: " + instanceId);
+        return;
+    }
+    const auto& registry = getMethodRegistry();
+    auto method = registry.find(methodName);
+    if (method == registry.end()) {
+        sendError(fd, "Unknown method: " + methodName);
+        return;
+    }
+    if (runs <= 0 && timeLimit <= 0) {
+        sendError(fd, "A solve needs a run count or a time limit");
+        return;
+    }
+
+    MultiStartOptions options = MultiStartOptions::fromEnvironment();
+    options.masterSeed = seed;
+    options.threads = requestThreads > 0 ? requestThreads : this->threads;
+    options.timeLimitSeconds = std::max(0.0, timeLimit);
+    Incumbent incumbent(target);
+    options.incumbent = &incumbent;
+
+    std::shared_lock<std::shared_mutex> access(resident->access);
+    auto startTime = std::chrono::steady_clock::now();
+    MultiStartResult result;
+    std::atomic<bool> finished(false);
+    std::thread worker([&]() {
+        result = method->second.run(resident->instance, params, runs, options);
+        finished = true;
+    });
+
+    // The incumbent's readers never block the searches, so polling it costs them nothing
+    int sentObjective = std::numeric_limits<int>::max();
+    bool connected = true;
+    std::vector<int> tour;
+    auto report = [&]() {
+        int objective;
+        if (!connected || incumbent.objective() >= sentObjective || !incumbent.snapshot(objective, tour) || objective >= sentObjective)
+            return;
+        sentObjective = objective;
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+        connected = ServiceMessage(ServiceMessage::Improved).putInt(objective).putDouble(seconds).putInts(tour).send(fd);
+    };
+    while (!finished) {
+        report();
+        std::this_thread::sleep_for(pollInterval);
+    }
+    worker.join();
+    report();
+
+    ServiceMessage(ServiceMessage::Done)
+        .putInt(result.runs)
+        .putInt(result.bestRun != -1 ? result.bestObjective : 0)
+        .putInt(result.bestRun != -1 ? result.worstObjective : 0)
+        .putDouble(result.averageObjective())
+        .putDouble(result.elapsedSeconds)
+        .putInt(result.targetReached ? 1 : 0)
+        .putInts(result.bestSolution)
+        .send(fd);
+}
+
+void SolverService::reoptimize(int fd, ServiceMessage& request) {
+    std::string instanceId = request.getString();
+    bool orOpt = request.getInt() != 0;
+    std::vector<int> solution = request.getInts();
+    int updateCount = request.getInt();
+    std::vector<NodeUpdate> updates;
+    for (int u = 0; u < updateCount && request.valid(); ++u) {
+        NodeUpdate update;
+        update.node = request.getInt();
+        int fields = request.getInt();
+        update.setCost = (fields & 1) != 0;
+        update.setPosition = (fields & 2) != 0;
+        update.cost = request.getInt();
+        update.x = request.getInt();
+        update.y = request.getInt();
+        updates.push_back(update);
+    }
+    int appendCount = request.getInt();
+    std::vector<std::vector<int>> appended;
+    for (int a = 0; a < appendCount && request.valid(); ++a) {
+        int x = request.getInt(), y = request.getInt();
+        appended.push_back({x, y, request.getInt()});
+    }
+
+    if (!request.valid()) {
+        sendError(fd, "Malformed reoptimize request");
+        return;
+    }
+    std::shared_ptr<Resident> resident = find(instanceId);
+    if (!resident) {
+        sendError(fd, "Unknown instance: " + instanceId);
+        return;
+    }
+
+    std::unique_lock<std::shared_mutex> access(resident->access);
+    int size = resident->instance.getSize();
+    std::vector<char> seen(size, 0);
+    for (int v : solution) {
+        if (v < 0 || v >= size || seen[v]) {
+            sendError(fd, "Invalid tour for instance " + instanceId);
+            return;
+        }
+        seen[v] = 1;
+    }
+
+    auto startTime = std::chrono::steady_clock::now();
+    int objective = ::reoptimize(resident->instance, solution, updates, orOpt, appended);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    ServiceMessage(ServiceMessage::Done)
+        .putInt(1).putInt(objective).putInt(objective).putDouble(objective).putDouble(seconds).putInt(0)
+        .putInts(solution)
+        .send(fd);
+}
+
+#else
+
+bool SolverService::serve(const std::string&) {
+    std::cerr << "The solver service needs Unix domain sockets" << std::endl;
+    return false;
+}
+
+#endif
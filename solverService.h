@@ -0,0 +1,67 @@
+#ifndef SOLVER_SERVICE_H
+#define SOLVER_SERVICE_H
+
+#include <map>
+#include <set>
+#include <mutex>
+#include <shared_mutex>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <condition_variable>
+
+#include "dataManager.h"
+
+class ServiceMessage;
+
+/**
+ * @brief Long-lived solver behind a Unix domain socket (serviceProtocol.h).
+ *
+ * Instances are read and their distance matrix built once, on load(), and
+ * stay resident with their candidate lists (CandidateListCache), so a solve
+ * request only pays for the search. Every connection gets its own thread and
+ * may send any number of requests. A solve runs a registry method under the
+ * requested time limit, runs, seed and target, while the connection thread
+ * polls the solve's Incumbent and streams each improved tour to the client.
+ * A reoptimize request changes node costs and coordinates of an instance in
+ * place, may append nodes to it, and re-optimizes or extends the client's
+ * tour (warmStart.h); it waits for the solves running on the instance, and
+ * solves started meanwhile wait for it.
+ * Reloading an id replaces the instance for later requests; requests still
+ * running keep the old one.
+ */
+class SolverService {
+public:
+    // threads: worker threads of a solve that does not ask for a count
+    explicit SolverService(int threads);
+
+    // Reads the instance CSV at path and keeps it as id; false with the reason in error
+    bool load(const std::string& id, const std::string& path, std::string& error);
+    // Serves connections until a Shutdown request; false if the socket could not be opened
+    bool serve(const std::string& socketPath);
+
+private:
+    void handle(int fd);
+    void solve(int fd, ServiceMessage& request);
+    void reoptimize(int fd, ServiceMessage& request);
+
+    struct Resident {
+        explicit Resident(const std::vector<std::vector<int>>& data) : instance(data) {}
+        ~Resident(); // drops the cached candidate lists, which are keyed by the matrix address
+
+        DataManager instance;
+        std::shared_mutex access; // shared by solves, exclusive for in-place changes
+    };
+    std::shared_ptr<Resident> find(const std::string& id);
+
+    int threads;
+    std::map<std::string, std::shared_ptr<Resident>> instances;
+    std::set<int> connections;
+    int activeConnections = 0;
+    std::mutex mutex; // guards instances, connections and activeConnections
+    std::condition_variable idle;
+    std::atomic<bool> stopping{false};
+    int listenFd = -1;
+};
+
+#endif
@@ -0,0 +1,43 @@
+#ifndef TOUR_HASH_H
+#define TOUR_HASH_H
+
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+#include "multiStartRunner.h"
+
+/**
+ * @brief Zobrist hash of a tour: XOR of a key per selected node and a key per
+ * undirected edge. Rotating or reversing the cycle does not change it, and a
+ * move is hashed in O(1) by toggling the nodes and edges it removes and adds.
+ * Keys are SplitMix64 hashes of the node id / node pair, so no key table is
+ * stored and hashes agree between runs, threads and processes.
+ */
+struct TourHash {
+    uint64_t value = 0;
+
+    static uint64_t nodeKey(int v) {
+        return RunRng::mix(static_cast<uint64_t>(v) + 0x5851F42D4C957F2DULL);
+    }
+
+    static uint64_t edgeKey(int u, int v) {
+        uint64_t lo = static_cast<uint32_t>(std::min(u, v)), hi = static_cast<uint32_t>(std::max(u, v));
+        return RunRng::mix((hi << 32 | lo) ^ 0xD1B54A32D192ED03ULL);
+    }
+
+    void toggleNode(int v) { value ^= nodeKey(v); }
+    void toggleEdge(int u, int v) { value ^= edgeKey(u, v); }
+
+    static TourHash of(const std::vector<int> &solution) {
+        TourHash hash;
+        int n = static_cast<int>(solution.size());
+        for (int i = 0; i < n; ++i) {
+            hash.toggleNode(solution[i]);
+            if (n > 1) hash.toggleEdge(solution[i], solution[(i + 1) % n]);
+        }
+        return hash;
+    }
+};
+
+#endif
@@ -0,0 +1,201 @@
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <cstdlib>
+#include <random>
+#include <algorithm>
+
+#include "tourPartition.h"
+#include "localSearch.h"
+#include "tourUtils.h"
+#include "scanTeam.h"
+#include "deadline.h"
+
+#define dist(u, v) distanceMatrix[u][v]
+#define cost(n) costVector[n]
+
+namespace {
+    // Nearest-neighbour walk by distance + cost: the first free candidate of the current node, or when all of
+    // them are taken the nearest free node by a full scan. The scans cost at most O(size^2), the order of the
+    // distance matrix itself
+    std::vector<int> candidateWalk(int **distanceMatrix, const std::vector<int> &costVector,
+                                   const std::vector<std::vector<int>> &candidateList, int size, RunRng &g) {
+        int nodesToVisit = getNodesToVisit(size);
+        std::vector<char> taken(size, 0);
+        std::vector<int> tour;
+        tour.reserve(nodesToVisit);
+
+        std::uniform_int_distribution<int> startDist(0, size - 1);
+        for (int u = startDist(g); ; ) {
+            tour.push_back(u);
+            taken[u] = 1;
+            if (static_cast<int>(tour.size()) >= nodesToVisit) break;
+
+            int v = -1;
+            for (int w : candidateList[u])
+                if (!taken[w]) {
+                    v = w;
+                    break;
+                }
+            for (int w = 0; v == -1 && w < size; ++w) {
+                if (taken[w]) continue;
+                int best = w;
+                for (int x = w + 1; x < size; ++x)
+                    if (!taken[x] && dist(u, x) + cost(x) < dist(u, best) + cost(best)) best = x;
+                v = best;
+            }
+            u = v;
+        }
+        return tour;
+    }
+
+    /**
+     * Steepest descent on the path tour[first..last] with both end nodes fixed; returns the objective change.
+     * owner is read-only here, and pos and used are only touched for nodes this segment owns, so segments
+     * run concurrently on the same arrays.
+     */
+    int optimizeSegment(int **distanceMatrix, const std::vector<int> &costVector, const std::vector<std::vector<int>> &candidateList,
+                        std::vector<int> &tour, int first, int last, int segment,
+                        const std::vector<int> &owner, std::vector<int> &pos, std::vector<char> &used)
+    {
+        auto localPos = [&](int v) {
+            if (v == tour[first]) return first;
+            if (v == tour[last]) return last;
+            return owner[v] == segment && used[v] ? pos[v] : -1;
+        };
+
+        Deadline &deadline = Deadline::current();
+        int gain = 0;
+        while (!deadline.reached()) {
+            EC_COUNT(iterations, 1);
+            int bestDelta = 0;
+            bool bestIsExchange = false;
+            int bestA = -1, bestB = -1; // 2-opt: reverse positions bestA..bestB; exchange: position bestA gets node bestB
+
+            for (int i = first; i <= last; ++i) {
+                int u = tour[i];
+                if (deadline.expired(static_cast<long>(candidateList[u].size()))) break;
+
+                for (int v : candidateList[u]) {
+                    int j = localPos(v);
+                    if (j != -1) {
+                        if (std::abs(i - j) <= 1) continue;
+                        // (u, v) replaces the edges after u and v, or the edges before them; both must lie on the path
+                        if (i < last && j < last) {
+                            int delta = dist(u, v) + dist(tour[i + 1], tour[j + 1]) - dist(u, tour[i + 1]) - dist(v, tour[j + 1]);
+                            EC_COUNT(intraEvaluated, 1);
+                            if (delta < bestDelta) {
+                                bestDelta = delta;
+                                bestIsExchange = false;
+                                bestA = std::min(i, j) + 1;
+                                bestB = std::max(i, j);
+                            }
+                        }
+                        if (i > first && j > first) {
+                            int delta = dist(u, v) + dist(tour[i - 1], tour[j - 1]) - dist(tour[i - 1], u) - dist(tour[j - 1], v);
+                            EC_COUNT(intraEvaluated, 1);
+                            if (delta < bestDelta) {
+                                bestDelta = delta;
+                                bestIsExchange = false;
+                                bestA = std::min(i, j);
+                                bestB = std::max(i, j) - 1;
+                            }
+                        }
+                    } else if (owner[v] == segment && !used[v]) {
+                        // v takes the place of u's inner successor or predecessor w, next to u
+                        for (int k : {i + 1, i - 1}) {
+                            if (k <= first || k >= last) continue;
+                            int w = tour[k];
+                            int far = tour[2 * k - i];
+                            int delta = dist(u, v) + dist(v, far) + cost(v) - dist(u, w) - dist(w, far) - cost(w);
+                            EC_COUNT(exchangeEvaluated, 1);
+                            if (delta < bestDelta) {
+                                bestDelta = delta;
+                                bestIsExchange = true;
+                                bestA = k;
+                                bestB = v;
+                            }
+                        }
+                    }
+                }
+            }
+
+            if (bestDelta >= 0) break;
+            EC_COUNT(movesApplied, 1);
+            gain += bestDelta;
+            if (bestIsExchange) {
+                used[tour[bestA]] = 0;
+                used[bestB] = 1;
+                pos[bestB] = bestA;
+                tour[bestA] = bestB;
+            } else {
+                std::reverse(tour.begin() + bestA, tour.begin() + bestB + 1);
+                for (int p = bestA; p <= bestB; ++p) pos[tour[p]] = p;
+            }
+        }
+        return gain;
+    }
+}
+
+MultiStartResult partitionSteepest(int **distanceMatrix, const std::vector<int> &costVector, int size,
+                                   const PartitionParams &params, int totalRuns, const MultiStartOptions &options)
+{
+    if (size <= 0) return MultiStartResult();
+
+    std::vector<std::vector<int>> candidateList = createCandidateList(distanceMatrix, costVector, size, params.K);
+    int scanParts = scanTeamSize(options, size, totalRuns);
+    int length = std::max(3, params.segmentLength);
+
+    return runMultiStart(totalRuns, [&](int, RunRng &g) -> RunResult {
+        std::vector<int> tour = candidateWalk(distanceMatrix, costVector, candidateList, size, g);
+        int n = static_cast<int>(tour.size());
+        if (n < 4) return {evaluateSolution(tour, distanceMatrix, costVector), tour};
+
+        std::vector<char> used(size, 0);
+        for (int v : tour) used[v] = 1;
+        std::vector<int> pos(size, -1), owner(size, -1);
+        std::unique_ptr<ScanTeam> team = scanParts > 1 ? std::make_unique<ScanTeam>(scanParts) : nullptr;
+
+        int idleRounds = 0;
+        for (int round = 0; round < params.rounds && idleRounds < 2 && !Deadline::current().reached(); ++round) {
+            if (round > 0) std::rotate(tour.begin(), tour.begin() + std::min(n - 1, length / 2), tour.end());
+            for (int p = 0; p < n; ++p) pos[tour[p]] = p;
+
+            // Segment s covers positions starts[s]..starts[s + 1]; the edge from the last position back to 0 stays
+            std::vector<int> starts;
+            for (int p = 0; p < n - 1; p += length - 1) starts.push_back(p);
+            starts.push_back(n - 1);
+            int segments = static_cast<int>(starts.size()) - 1;
+
+            std::fill(owner.begin(), owner.end(), -1);
+            for (int s = 0; s < segments; ++s)
+                for (int p = starts[s] + 1; p < starts[s + 1]; ++p) owner[tour[p]] = s;
+            for (int v = 0; v < size; ++v) {
+                if (used[v]) continue;
+                for (int w : candidateList[v])
+                    if (used[w] && owner[w] != -1) {
+                        owner[v] = owner[w];
+                        break;
+                    }
+            }
+
+            std::vector<int> gains(segments, 0);
+            auto optimize = [&](int s) {
+                gains[s] = optimizeSegment(distanceMatrix, costVector, candidateList, tour, starts[s], starts[s + 1], s, owner, pos, used);
+            };
+            if (team) {
+                std::atomic<int> nextSegment(0);
+                team->run([&](int) {
+                    for (int s = nextSegment.fetch_add(1); s < segments; s = nextSegment.fetch_add(1)) optimize(s);
+                });
+            } else {
+                for (int s = 0; s < segments; ++s) optimize(s);
+            }
+
+            bool improved = std::any_of(gains.begin(), gains.end(), [](int gain) { return gain < 0; });
+            idleRounds = improved ? 0 : idleRounds + 1;
+        }
+
+        return {evaluateSolution(tour, distanceMatrix, costVector), tour};
+    }, options);
+}
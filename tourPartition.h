@@ -0,0 +1,34 @@
+#ifndef TOUR_PARTITION_H
+#define TOUR_PARTITION_H
+
+#include <vector>
+
+#include "multiStartRunner.h"
+
+struct PartitionParams {
+    int K = 10;               // candidate neighbours per node (createCandidateList)
+    int segmentLength = 1000; // tour positions per segment, both fixed ends included
+    int rounds = 8;           // segment passes; each shifts the boundaries by half a segment
+};
+
+/**
+ * @brief Candidate-list steepest search by tour decomposition, for instances
+ * where one search over the whole tour takes too long.
+ *
+ * The start tour is a nearest-neighbour walk by distance + cost over the
+ * candidate lists (a full scan only when all candidates are taken), so
+ * consecutive positions are close and a stretch of the tour is a local
+ * region. Each round cuts the tour into segments of segmentLength positions
+ * that share their end nodes, and optimizes every segment as a path with both
+ * ends fixed: 2-opt moves inside it (plain subarray reversals) and exchanges
+ * of its inner nodes for unselected nodes it owns, i.e. whose first selected
+ * candidate lies in it. Segments touch disjoint parts of the tour and the
+ * node arrays, so a ScanTeam (scanTeamSize) optimizes them in parallel and
+ * the result does not depend on the thread count. The next round rotates the
+ * boundaries by half a segment; two rounds without gain end the run.
+ */
+MultiStartResult partitionSteepest(int **distanceMatrix, const std::vector<int> &costVector, int size,
+                                   const PartitionParams &params = PartitionParams(), int totalRuns = 1,
+                                   const MultiStartOptions &options = MultiStartOptions::fromEnvironment());
+
+#endif
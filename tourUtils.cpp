@@ -0,0 +1,75 @@
+#include <vector>
+#include <numeric>
+#include <algorithm>
+
+#include "tourUtils.h"
+
+int getNodesToVisit(int size)
+{
+    return (size % 2 == 0) ? (size / 2) : ((size + 1) / 2);
+}
+
+int evaluateSolution(const std::vector<int> &solution, int **distanceMatrix, const std::vector<int> &costVector)
+{
+    int totalCost = 0;
+    if (solution.empty()) return 0;
+    for (size_t i = 0; i < solution.size(); ++i)
+    {
+        totalCost += costVector[solution[i]];
+        totalCost += distanceMatrix[solution[i]][solution[(i + 1) % solution.size()]];
+    }
+    return totalCost;
+}
+
+std::vector<int> randomPermutation(int size, RunRng &g)
+{
+    int nodesToVisit = getNodesToVisit(size);
+
+    std::vector<int> solution(size);
+    std::iota(solution.begin(), solution.end(), 0);
+    std::shuffle(solution.begin(), solution.end(), g);
+    solution.resize(nodesToVisit);
+    return solution;
+}
+
+void reverseCircularSegment(std::vector<int> &solution, int pos1, int pos2)
+{
+    int n = static_cast<int>(solution.size());
+    if (n == 0) return;
+    
+    pos1 = (pos1 % n + n) % n;
+    pos2 = (pos2 % n + n) % n;
+
+    int halfLen = 0;
+    if (pos1 <= pos2) {
+        halfLen = (pos2 - pos1 + 1) / 2;
+    } else {
+        halfLen = (n - pos1 + pos2 + 1) / 2;
+    }
+
+    for (int i = 0; i < halfLen; ++i)
+    {
+        std::swap(solution[pos1], solution[pos2]);
+        pos1 = (pos1 + 1) % n;
+        pos2 = (pos2 - 1 + n) % n;
+    }
+}
+
+void relocateSegment(std::vector<int> &solution, int start, int length, int afterNode, bool reversed)
+{
+    int n = static_cast<int>(solution.size());
+    std::vector<int> segment(length);
+    for (int k = 0; k < length; ++k)
+        segment[k] = solution[(start + k) % n];
+    if (reversed) std::reverse(segment.begin(), segment.end());
+
+    // The rest of the cycle, starting right after the segment, with the segment spliced in after afterNode
+    std::vector<int> relocated;
+    relocated.reserve(n);
+    for (int k = 0; k < n - length; ++k) {
+        int v = solution[(start + length + k) % n];
+        relocated.push_back(v);
+        if (v == afterNode) relocated.insert(relocated.end(), segment.begin(), segment.end());
+    }
+    solution.swap(relocated);
+}
@@ -0,0 +1,22 @@
+#ifndef TOUR_UTILS_H
+#define TOUR_UTILS_H
+
+#include <vector>
+
+#include "multiStartRunner.h"
+
+// Number of nodes a solution selects: half of the instance, rounded up
+int getNodesToVisit(int size);
+
+// Objective of a closed cycle: node costs plus all edges including the closing one
+int evaluateSolution(const std::vector<int> &solution, int **distanceMatrix, const std::vector<int> &costVector);
+
+std::vector<int> randomPermutation(int size, RunRng &g);
+
+void reverseCircularSegment(std::vector<int> &solution, int pos1, int pos2);
+
+// Or-opt: moves the `length` nodes from position start (circular) to between afterNode and its successor,
+// optionally reversed. The cycle is kept but its vector rotates, so positions must be rebuilt.
+void relocateSegment(std::vector<int> &solution, int start, int length, int afterNode, bool reversed);
+
+#endif
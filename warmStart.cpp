@@ -0,0 +1,110 @@
+#include <vector>
+#include <algorithm>
+
+#include "warmStart.h"
+#include "localSearch.h"
+#include "candidateListCache.h"
+#include "tourUtils.h"
+#include "regretInsertion.h"
+
+std::vector<int> applyNodeUpdates(DataManager &instance, const std::vector<NodeUpdate> &updates)
+{
+    int size = instance.getSize();
+    std::vector<int> changed, moved;
+    for (const NodeUpdate &update : updates) {
+        if (update.node < 0 || update.node >= size || (!update.setCost && !update.setPosition)) continue;
+        if (update.setCost) instance.updateCost(update.node, update.cost);
+        if (update.setPosition) {
+            instance.moveNode(update.node, update.x, update.y);
+            moved.push_back(update.node);
+        }
+        changed.push_back(update.node);
+    }
+    std::sort(changed.begin(), changed.end());
+    changed.erase(std::unique(changed.begin(), changed.end()), changed.end());
+    if (changed.empty()) return changed;
+
+    int **distanceMatrix = instance.getDistanceMatrix();
+    const std::vector<int> &costVector = instance.getCostVector();
+    CandidateListCache::shared().update(distanceMatrix, distanceMatrix, costVector, [&](int K, CandidateListCache::CandidateList &candidateList) {
+        updateCandidateList(distanceMatrix, costVector, size, K, candidateList, changed, moved);
+    });
+    return changed;
+}
+
+std::vector<int> appendNodes(DataManager &instance, const std::vector<std::vector<int>> &rows)
+{
+    int oldSize = instance.getSize();
+    int **previousMatrix = instance.getDistanceMatrix();
+    instance.appendNodes(rows);
+
+    int size = instance.getSize();
+    std::vector<int> added;
+    for (int v = oldSize; v < size; ++v) added.push_back(v);
+    if (added.empty()) return added;
+
+    // A new node is a changed node with an empty list of its own to build
+    int **distanceMatrix = instance.getDistanceMatrix();
+    const std::vector<int> &costVector = instance.getCostVector();
+    CandidateListCache::shared().update(previousMatrix, distanceMatrix, costVector, [&](int K, CandidateListCache::CandidateList &candidateList) {
+        candidateList.resize(size);
+        updateCandidateList(distanceMatrix, costVector, size, K, candidateList, added, added);
+    });
+    return added;
+}
+
+int reoptimizeAround(int **distanceMatrix, const std::vector<int> &costVector, int size, std::vector<int> &solution,
+                     const std::vector<int> &changed, bool orOpt)
+{
+    int n = static_cast<int>(solution.size());
+    std::vector<int> pos(size, -1);
+    for (int i = 0; i < n; ++i) pos[solution[i]] = i;
+
+    // A changed node in the tour also changes the edges, and so the exchanges, of its neighbours
+    std::vector<int> seeds;
+    for (int v : changed) {
+        seeds.push_back(v);
+        if (pos[v] != -1 && n > 1) {
+            seeds.push_back(solution[(pos[v] - 1 + n) % n]);
+            seeds.push_back(solution[(pos[v] + 1) % n]);
+        }
+    }
+    std::sort(seeds.begin(), seeds.end());
+    seeds.erase(std::unique(seeds.begin(), seeds.end()), seeds.end());
+
+    std::vector<Move> LM;
+    addMovesAround(distanceMatrix, costVector, solution, pos, LM, size, seeds, orOpt);
+    runMoveListSearch(distanceMatrix, costVector, size, solution, pos, LM, orOpt);
+    return evaluateSolution(solution, distanceMatrix, costVector);
+}
+
+int extendTour(int **distanceMatrix, const std::vector<int> &costVector, int size, std::vector<int> &solution,
+               const std::vector<int> &changed, double alpha, bool orOpt)
+{
+    std::vector<int> seeds = changed;
+    int targetSize = getNodesToVisit(size);
+    if (static_cast<int>(solution.size()) < targetSize && !solution.empty()) {
+        RegretInsertionTour tour(distanceMatrix, costVector, size);
+        tour.assign(solution, evaluateSolution(solution, distanceMatrix, costVector));
+        tour.repair(targetSize, alpha);
+
+        std::vector<char> wasInTour(size, 0);
+        for (int v : solution) wasInTour[v] = 1;
+        solution = tour.toSolution();
+        for (int v : solution)
+            if (!wasInTour[v]) seeds.push_back(v);
+    }
+    return reoptimizeAround(distanceMatrix, costVector, size, solution, seeds, orOpt);
+}
+
+int reoptimize(DataManager &instance, std::vector<int> &solution, const std::vector<NodeUpdate> &updates, bool orOpt,
+               const std::vector<std::vector<int>> &appended)
+{
+    std::vector<int> changed = applyNodeUpdates(instance, updates);
+    if (appended.empty())
+        return reoptimizeAround(instance.getDistanceMatrix(), instance.getCostVector(), instance.getSize(), solution, changed, orOpt);
+
+    std::vector<int> added = appendNodes(instance, appended);
+    changed.insert(changed.end(), added.begin(), added.end());
+    return extendTour(instance.getDistanceMatrix(), instance.getCostVector(), instance.getSize(), solution, changed, 0.5, orOpt);
+}
@@ -0,0 +1,62 @@
+#ifndef WARM_START_H
+#define WARM_START_H
+
+#include <vector>
+
+#include "dataManager.h"
+
+// New cost and/or coordinates of one node
+struct NodeUpdate {
+    int node;
+    bool setCost = false;
+    int cost = 0;
+    bool setPosition = false;
+    int x = 0, y = 0;
+};
+
+/**
+ * @brief Applies the updates to the instance in place: costs, the distance
+ * row and column of every moved node, and the candidate lists cached for it
+ * (CandidateListCache, via updateCandidateList). Returns the changed nodes.
+ * O(moved * size) plus the candidate rows that held a changed node, instead
+ * of the O(size^2) of rebuilding the instance. No search may use the
+ * instance meanwhile.
+ */
+std::vector<int> applyNodeUpdates(DataManager &instance, const std::vector<NodeUpdate> &updates);
+
+/**
+ * @brief Move-list steepest search (runMoveListSearch) from a tour that was
+ * a local optimum before the changed nodes changed. The move list starts
+ * with the moves around the changed nodes and their tour neighbours only;
+ * every other move kept its delta, so it still does not gain, and the search
+ * goes on from the moves around each applied one as usual. The result is a
+ * local optimum of the move list, as for moveListSteepest. Returns the new
+ * objective of the tour.
+ */
+int reoptimizeAround(int **distanceMatrix, const std::vector<int> &costVector, int size, std::vector<int> &solution,
+                     const std::vector<int> &changed, bool orOpt = false);
+
+/**
+ * @brief Appends nodes given as CSV rows (x, y, cost) to the instance
+ * (DataManager::appendNodes) and inserts them into the candidate lists cached
+ * for it, rebuilding only the lists of the new nodes. Returns the new nodes,
+ * which are numbered from the old size on. No search may use the instance
+ * meanwhile.
+ */
+std::vector<int> appendNodes(DataManager &instance, const std::vector<std::vector<int>> &rows);
+
+/**
+ * @brief Grows a tour to the node count of a grown instance (getNodesToVisit)
+ * by weighted 2-regret insertion over all unselected nodes
+ * (RegretInsertionTour, as in the LNS repair), then re-optimizes around the
+ * inserted and changed nodes (reoptimizeAround), so new nodes that were not
+ * inserted may still enter by exchange. Returns the new objective of the tour.
+ */
+int extendTour(int **distanceMatrix, const std::vector<int> &costVector, int size, std::vector<int> &solution,
+               const std::vector<int> &changed, double alpha = 0.5, bool orOpt = false);
+
+// applyNodeUpdates and appendNodes, then reoptimizeAround, or extendTour if nodes were appended
+int reoptimize(DataManager &instance, std::vector<int> &solution, const std::vector<NodeUpdate> &updates, bool orOpt = false,
+               const std::vector<std::vector<int>> &appended = {});
+
+#endif